@@ -0,0 +1,153 @@
+#pragma once
+
+#include <stdint.h>
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     Helper routines to store unsigned 32 bit integers with a fixed bit width in a sequence of 64 bit words.
+     *  \details   Values are packed in blocks of BitPacking::BLOCK_SIZE values, so a block with a bit width of b occupies exactly b words.
+     *             The unpack kernels are specialized for every bit width and read one word past the end of a block without branching,
+     *             so the word vector of an encoding has to end with a zero guard word behind its last block.
+     */
+    namespace BitPacking {
+
+        /*! \brief number of values stored in one packed block*/
+        const unsigned int BLOCK_SIZE = 64;
+
+        typedef void (*UnpackFunction)(const uint64_t* in, uint32_t* out);
+
+        /*! \brief returns the number of bits needed to represent value (0 for value 0)*/
+        inline unsigned int getNeededBits(uint32_t value) {
+            unsigned int bits = 0;
+            while (value != 0) {
+                bits++;
+                value >>= 1;
+            }
+            return bits;
+        }
+
+        /*! \brief returns the largest value that fits into the given bit width*/
+        inline uint32_t getMaxValue(unsigned int bits) {
+            return (uint32_t) ((uint64_t(1) << bits) - 1);
+        }
+
+        /*! \brief returns the number of bits needed to represent every value of the array*/
+        inline unsigned int getMaxBits(const uint32_t* in, size_t count) {
+            uint32_t accumulated = 0;
+            for (size_t i = 0; i < count; i++) {
+                accumulated |= in[i];
+            }
+            return getNeededBits(accumulated);
+        }
+
+        /*! \brief packs BLOCK_SIZE values into bits words starting at out*/
+        inline void packBlock(const uint32_t* in, unsigned int bits, uint64_t* out) {
+            for (unsigned int i = 0; i < bits; i++) {
+                out[i] = 0;
+            }
+            if (bits == 0) {
+                return;
+            }
+            const uint64_t mask = (uint64_t(1) << bits) - 1;
+            for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+                uint64_t bitPosition = uint64_t(i) * bits;
+                unsigned int word = bitPosition >> 6;
+                unsigned int shift = bitPosition & 63;
+                uint64_t value = in[i] & mask;
+                out[word] |= value << shift;
+                //the value overlaps into the next word
+                if (shift + bits > 64) {
+                    out[word + 1] |= value >> (64 - shift);
+                }
+            }
+        }
+
+        /*! \brief unpack kernel for a fixed bit width, the branch free word access lets the compiler unroll and vectorize it*/
+        template<unsigned int BITS>
+        void unpackBlockKernel(const uint64_t* in, uint32_t* out) {
+            const uint64_t mask = (uint64_t(1) << BITS) - 1;
+            for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+                const unsigned int bitPosition = i * BITS;
+                const unsigned int word = bitPosition >> 6;
+                const unsigned int shift = bitPosition & 63;
+                //the double shift avoids an undefined shift by 64 in case shift is 0
+                out[i] = (uint32_t) (((in[word] >> shift) | ((in[word + 1] << 1) << (63 - shift))) & mask);
+            }
+        }
+
+        template<>
+        inline void unpackBlockKernel<0>(const uint64_t*, uint32_t* out) {
+            for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+                out[i] = 0;
+            }
+        }
+
+        /*! \brief unpacks BLOCK_SIZE values with the given bit width into out*/
+        inline void unpackBlock(const uint64_t* in, unsigned int bits, uint32_t* out) {
+            static const UnpackFunction kernels[33] = {
+                &unpackBlockKernel<0>, &unpackBlockKernel<1>, &unpackBlockKernel<2>, &unpackBlockKernel<3>,
+                &unpackBlockKernel<4>, &unpackBlockKernel<5>, &unpackBlockKernel<6>, &unpackBlockKernel<7>,
+                &unpackBlockKernel<8>, &unpackBlockKernel<9>, &unpackBlockKernel<10>, &unpackBlockKernel<11>,
+                &unpackBlockKernel<12>, &unpackBlockKernel<13>, &unpackBlockKernel<14>, &unpackBlockKernel<15>,
+                &unpackBlockKernel<16>, &unpackBlockKernel<17>, &unpackBlockKernel<18>, &unpackBlockKernel<19>,
+                &unpackBlockKernel<20>, &unpackBlockKernel<21>, &unpackBlockKernel<22>, &unpackBlockKernel<23>,
+                &unpackBlockKernel<24>, &unpackBlockKernel<25>, &unpackBlockKernel<26>, &unpackBlockKernel<27>,
+                &unpackBlockKernel<28>, &unpackBlockKernel<29>, &unpackBlockKernel<30>, &unpackBlockKernel<31>,
+                &unpackBlockKernel<32>
+            };
+            kernels[bits](in, out);
+        }
+
+        /*! \brief extracts the value at position index of a packed block*/
+        inline uint32_t extract(const uint64_t* in, unsigned int bits, unsigned int index) {
+            //a block with bit width 0 occupies no words, so there is nothing to read
+            if (bits == 0) {
+                return 0;
+            }
+            const uint64_t bitPosition = uint64_t(index) * bits;
+            const unsigned int word = bitPosition >> 6;
+            const unsigned int shift = bitPosition & 63;
+            const uint64_t mask = (uint64_t(1) << bits) - 1;
+            return (uint32_t) (((in[word] >> shift) | ((in[word + 1] << 1) << (63 - shift))) & mask);
+        }
+
+        /*!
+         *  \brief     decodes the values [begin, begin + count) of a column, whose first numberOfBlocks * BLOCK_SIZE values are
+         *             stored in packed blocks and whose remaining values are stored in uncompressedTail.
+         *  \details   Only the unpacking of a block differs between the encodings, so the encoding passes its unpackBlock member,
+         *             which writes the BLOCK_SIZE values of a block. Complete blocks are unpacked directly into out, partially
+         *             covered blocks through a buffer.
+         */
+        template<class Column, class T>
+        inline void decodeBlocks(const Column& column, void (Column::*unpackBlock)(uint64_t, T*) const, uint64_t numberOfBlocks,
+                const std::vector<T>& uncompressedTail, uint64_t begin, size_t count, T* out) {
+            T values[BLOCK_SIZE];
+            uint64_t end = begin + count;
+            uint64_t position = begin;
+            while (position < end && position / BLOCK_SIZE < numberOfBlocks) {
+                uint64_t blockIndex = position / BLOCK_SIZE;
+                uint64_t blockBegin = blockIndex * BLOCK_SIZE;
+                uint64_t blockEnd = std::min(end, blockBegin + BLOCK_SIZE);
+                if (position == blockBegin && blockEnd == blockBegin + BLOCK_SIZE) {
+                    (column.*unpackBlock)(blockIndex, out + (position - begin));
+                } else {
+                    (column.*unpackBlock)(blockIndex, values);
+                    std::copy(values + (position - blockBegin), values + (blockEnd - blockBegin), out + (position - begin));
+                }
+                position = blockEnd;
+            }
+
+            //the remaining values are copied from the uncompressed tail
+            uint64_t tailBegin = numberOfBlocks * BLOCK_SIZE;
+            if (position < end) {
+                std::copy(uncompressedTail.begin() + (position - tailBegin), uncompressedTail.begin() + (end - tailBegin), out + (position - begin));
+            }
+        }
+
+    }; //end namespace BitPacking
+
+}; //end namespace CogaDB
@@ -37,15 +37,47 @@ namespace CoGaDB {
 
         virtual const ColumnPtr copy() const;
 
+        /*! \brief sweeps every bitvector once over the range and writes its value wherever its bit is set*/
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief returns a cursor that keeps a position in every bitvector*/
+        virtual typename ColumnBaseTyped<T>::ColumnCursorPtr createCursor();
+        /*! \brief sweeps every bitvector once over the TID list*/
+        virtual void gather(const PositionList& tids, T* out);
+        /*! \brief emits the set bits of every bitvector, the bitvectors are visited in the order of their values*/
+        virtual const PositionListPtr sort(SortOrder order);
+        /*! \brief returns the number of bitvectors*/
+        virtual size_t getNumberOfDistinctValues();
+        /*! \brief transforms the values of the bitvectors, bitvectors of values that became equal are merged*/
+        virtual bool transformValues(ArithmeticOperation operation, const T& constant);
+
         virtual bool store(const std::string& path);
         virtual bool load(const std::string& path);
 
 
 
+        /*! \brief returns a reference to a copy of the value, writes have to use update()*/
         virtual T& operator[](const int index);
 
     private:
 
+        /*cursor over all bitvectors, which advances one position per bitvector and value*/
+        class Cursor : public ColumnCursor<T> {
+        public:
+            Cursor(const BitVectorEncoding<T>& column);
+
+        protected:
+            virtual void decodeNext(TID begin, size_t count, T* out);
+
+        private:
+            /*vector<[VALUE]> and vector<[POSITION_IN_BITVECTOR]>*/
+            std::vector<const T*> values;
+            std::vector<std::vector<bool>::const_iterator> positions;
+            TID position;
+        };
+
+        //appends the positions of all set bits to ids
+        static void appendPositions(const std::vector<bool>& bitVector, PositionList& ids);
+
         /*!compressed values structure*/
         /*map<[VALUE],vector<RECORD_FLAG> >*/
         std::map<T, std::vector<bool> > valueBitVectorMap;
@@ -215,6 +247,42 @@ namespace CoGaDB {
         return ColumnPtr(new BitVectorEncoding<T>(*this));
     }
 
+    template<class T>
+    void BitVectorEncoding<T>::decode(TID begin, size_t count, T* out) {
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = valueBitVectorMap.begin(); it != valueBitVectorMap.end(); it++) {
+            std::vector<bool>::const_iterator bit = it->second.begin() + begin;
+            for (size_t i = 0; i < count; i++, ++bit) {
+                if (*bit) {
+                    out[i] = it->first;
+                }
+            }
+        }
+    }
+
+    template<class T>
+    typename ColumnBaseTyped<T>::ColumnCursorPtr BitVectorEncoding<T>::createCursor() {
+        return typename ColumnBaseTyped<T>::ColumnCursorPtr(new Cursor(*this));
+    }
+
+    template<class T>
+    void BitVectorEncoding<T>::gather(const PositionList& tids, T* out) {
+        std::vector<const T*> values;
+        std::vector<const std::vector<bool>*> bitVectors;
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = valueBitVectorMap.begin(); it != valueBitVectorMap.end(); it++) {
+            values.push_back(&it->first);
+            bitVectors.push_back(&it->second);
+        }
+        //exactly one bitvector has the bit of a TID set, so the search for the value of a TID stops at this bitvector
+        for (size_t i = 0; i < tids.size(); i++) {
+            for (size_t v = 0; v < bitVectors.size(); v++) {
+                if ((*bitVectors[v])[tids[i]]) {
+                    out[i] = *values[v];
+                    break;
+                }
+            }
+        }
+    }
+
     template<class T>
     bool BitVectorEncoding<T>::update(TID tid, const boost::any& newValue) {
         //check for empty compressed column, or different type value or out of range tid
@@ -376,6 +444,83 @@ namespace CoGaDB {
         return size_in_bytes;
     }
 
+    template<class T>
+    BitVectorEncoding<T>::Cursor::Cursor(const BitVectorEncoding<T>& column) : ColumnCursor<T>(column.size()), values(), positions(), position(0) {
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = column.valueBitVectorMap.begin(); it != column.valueBitVectorMap.end(); it++) {
+            values.push_back(&it->first);
+            positions.push_back(it->second.begin());
+        }
+    }
+
+    template<class T>
+    void BitVectorEncoding<T>::Cursor::decodeNext(TID begin, size_t count, T* out) {
+        //every bitvector is swept from the end of the last batch on
+        for (uint64_t i = 0; i < positions.size(); i++) {
+            std::vector<bool>::const_iterator bit = positions[i] + (begin - position);
+            for (size_t j = 0; j < count; j++, ++bit) {
+                if (*bit) {
+                    out[j] = *values[i];
+                }
+            }
+            positions[i] = bit;
+        }
+        position = begin + count;
+    }
+
+    template<class T>
+    const PositionListPtr BitVectorEncoding<T>::sort(SortOrder order) {
+        if (order != ASCENDING && order != DESCENDING) {
+            return ColumnBaseTyped<T>::sort(order);
+        }
+
+        PositionListPtr ids(new PositionList());
+        ids->reserve(this->size());
+        if (order == ASCENDING) {
+            for (typename std::map < T, std::vector<bool> >::const_iterator it = valueBitVectorMap.begin(); it != valueBitVectorMap.end(); it++) {
+                appendPositions(it->second, *ids);
+            }
+        } else {
+            for (typename std::map < T, std::vector<bool> >::const_reverse_iterator it = valueBitVectorMap.rbegin(); it != valueBitVectorMap.rend(); it++) {
+                appendPositions(it->second, *ids);
+            }
+        }
+        return ids;
+    }
+
+    template<class T>
+    void BitVectorEncoding<T>::appendPositions(const std::vector<bool>& bitVector, PositionList& ids) {
+        for (TID i = 0; i < bitVector.size(); i++) {
+            if (bitVector[i]) {
+                ids.push_back(i);
+            }
+        }
+    }
+
+    template<class T>
+    size_t BitVectorEncoding<T>::getNumberOfDistinctValues() {
+        return valueBitVectorMap.size();
+    }
+
+    template<class T>
+    bool BitVectorEncoding<T>::transformValues(ArithmeticOperation operation, const T& constant) {
+        //the bitvectors are moved to their new values, so only the keys of the map are computed
+        std::map<T, std::vector<bool> > transformedMap;
+        for (typename std::map < T, std::vector<bool> >::iterator it = valueBitVectorMap.begin(); it != valueBitVectorMap.end(); it++) {
+            std::vector<bool>& bitVector = transformedMap[applyArithmeticOperation(it->first, constant, operation)];
+            if (bitVector.empty()) {
+                bitVector.swap(it->second);
+            } else {
+                for (TID i = 0; i < bitVector.size(); i++) {
+                    if (it->second[i]) {
+                        bitVector[i] = true;
+                    }
+                }
+            }
+        }
+        valueBitVectorMap.swap(transformedMap);
+        return true;
+    }
+
     /***************** End of Implementation Section ******************/
 
 
@@ -0,0 +1,429 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <core/column.hpp>
+#include <compression/RunLengthEncoding.hpp>
+#include <compression/FrameOfReferenceEncoding.hpp>
+#include <compression/PatchedFrameOfReferenceEncoding.hpp>
+#include <compression/DeltaEncoding.hpp>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*! \brief encodings the dictionary codes of a CascadedEncoding can be stored with*/
+    enum CodeEncoding {
+        UNCOMPRESSED_CODES, RUN_LENGTH_CODES, FRAME_OF_REFERENCE_CODES, PATCHED_FRAME_OF_REFERENCE_CODES, DELTA_CODES
+    };
+
+    /*!
+     *  \brief     This class represents a cascade of a dictionary and an integer encoding with type T.
+     *  \details   Every distinct value gets an integer code in insertion order, and the column of codes is stored with the
+     *             integer encoding chosen by the CodeEncoding of the cascade, e.g. dictionary -> run length encoding of the codes
+     *             or dictionary -> frame of reference encoding of the codes. Selections are translated into the code domain and
+     *             evaluated by the code column, as long as the matching codes form one contiguous range. This is always the case
+     *             for columns filled in sorted order, where codes are ordered like their values.
+     *             The code column is stored next to the column in a file with the suffix "_codes".
+     */
+    template<class T>
+    class CascadedEncoding : public CompressedColumn<T> {
+    public:
+        /***************** constructors and destructor *****************/
+        CascadedEncoding(const std::string& name, AttributeType db_type, CodeEncoding codeEncoding = RUN_LENGTH_CODES);
+        virtual ~CascadedEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief decodes the codes with the decoder of the code column and translates them in one pass*/
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief returns a cursor that streams over the cursor of the code column*/
+        virtual typename ColumnBaseTyped<T>::ColumnCursorPtr createCursor();
+        /*! \brief gathers the codes from the code column and translates them*/
+        virtual void gather(const PositionList& tids, T* out);
+
+        /*! \brief translates the predicate into a range of codes and evaluates it on the code column*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+        /*! \brief returns the encoding of the dictionary codes*/
+        CodeEncoding getCodeEncoding() const throw ();
+
+        virtual T& operator[](const int index);
+
+    private:
+
+        typedef shared_pointer_namespace::shared_ptr<ColumnBaseTyped<int> > CodeColumnPtr;
+
+        /*creates an empty code column with the given encoding*/
+        static CodeColumnPtr createCodeColumn(const std::string& name, CodeEncoding codeEncoding);
+
+        /*returns the code of value and adds value to the dictionary if it is not there yet*/
+        int getCode(const T& value);
+
+        /*returns the TIDs of all codes in [firstCode,lastCode]*/
+        const PositionListPtr selectCodeRange(int firstCode, int lastCode);
+
+        CodeEncoding codeEncoding;
+        /*cursor that translates the values of a cursor over the code column*/
+        class Cursor : public ColumnCursor<T> {
+        public:
+            Cursor(CascadedEncoding<T>& column);
+
+        protected:
+            virtual void decodeNext(TID begin, size_t count, T* out);
+
+        private:
+            const CascadedEncoding<T>& column;
+            typename ColumnBaseTyped<int>::ColumnCursorPtr codeCursor;
+        };
+
+        /*compressed values structure*/
+        /*map<[VALUE],[DICTIONARY_CODE]>*/
+        std::map<T, int> dictionary;
+        /*vector<[VALUE]>, indexed by dictionary code*/
+        std::vector<T> dictionaryValues;
+        /*column<[DICTIONARY_CODE]>*/
+        CodeColumnPtr codes;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    CascadedEncoding<T>::CascadedEncoding(const std::string& name, AttributeType db_type, CodeEncoding codeEncoding_)
+    : CompressedColumn<T>(name, db_type), codeEncoding(codeEncoding_), dictionary(), dictionaryValues(), codes(createCodeColumn(name + "_codes", codeEncoding_)) {
+
+    }
+
+    template<class T>
+    CascadedEncoding<T>::~CascadedEncoding() {
+
+    }
+
+    template<class T>
+    typename CascadedEncoding<T>::CodeColumnPtr CascadedEncoding<T>::createCodeColumn(const std::string& name, CodeEncoding codeEncoding) {
+        if (codeEncoding == RUN_LENGTH_CODES) {
+            return CodeColumnPtr(new RunLengthEncoding<int>(name, INT));
+        } else if (codeEncoding == FRAME_OF_REFERENCE_CODES) {
+            return CodeColumnPtr(new FrameOfReferenceEncoding<int>(name, INT));
+        } else if (codeEncoding == PATCHED_FRAME_OF_REFERENCE_CODES) {
+            return CodeColumnPtr(new PatchedFrameOfReferenceEncoding<int>(name, INT));
+        } else if (codeEncoding == DELTA_CODES) {
+            return CodeColumnPtr(new DeltaEncoding<int>(name, INT));
+        }
+        return CodeColumnPtr(new Column<int>(name, INT));
+    }
+
+    template<class T>
+    CodeEncoding CascadedEncoding<T>::getCodeEncoding() const throw () {
+        return codeEncoding;
+    }
+
+    template<class T>
+    int CascadedEncoding<T>::getCode(const T& value) {
+        std::pair<typename std::map<T, int>::iterator, bool> entry = dictionary.insert(std::make_pair(value, (int) dictionaryValues.size()));
+        if (entry.second) {
+            dictionaryValues.push_back(value);
+        }
+        return entry.first->second;
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::insert(const T& newValue) {
+        return codes->insert(getCode(newValue));
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool CascadedEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any CascadedEncoding<T>::get(TID tid) {
+        if (tid < codes->size()) {
+            return boost::any(dictionaryValues[(*codes)[tid]]);
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void CascadedEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        for (TID i = 0; i < codes->size(); i++) {
+            std::cout << "| " << dictionaryValues[(*codes)[i]] << " |" << std::endl;
+        }
+    }
+
+    template<class T>
+    size_t CascadedEncoding<T>::size() const throw () {
+        return codes->size();
+    }
+
+    template<class T>
+    const ColumnPtr CascadedEncoding<T>::copy() const {
+        //the code column is copied as well, so that both columns can be changed independently
+        CascadedEncoding<T>* column = new CascadedEncoding<T>(*this);
+        column->codes = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<int> >(codes->copy());
+        return ColumnPtr(column);
+    }
+
+    template<class T>
+    void CascadedEncoding<T>::decode(TID begin, size_t count, T* out) {
+        if (count == 0) {
+            return;
+        }
+        std::vector<int> decodedCodes(count);
+        codes->decode(begin, count, &decodedCodes[0]);
+        for (size_t i = 0; i < count; i++) {
+            out[i] = dictionaryValues[decodedCodes[i]];
+        }
+    }
+
+    template<class T>
+    typename ColumnBaseTyped<T>::ColumnCursorPtr CascadedEncoding<T>::createCursor() {
+        return typename ColumnBaseTyped<T>::ColumnCursorPtr(new Cursor(*this));
+    }
+
+    template<class T>
+    void CascadedEncoding<T>::gather(const PositionList& tids, T* out) {
+        if (tids.empty()) {
+            return;
+        }
+        std::vector<int> gatheredCodes(tids.size());
+        codes->gather(tids, &gatheredCodes[0]);
+        for (size_t i = 0; i < tids.size(); i++) {
+            out[i] = dictionaryValues[gatheredCodes[i]];
+        }
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= codes->size()) {
+            return false;
+        }
+        return codes->update(tid, boost::any(getCode(boost::any_cast<T>(newValue))));
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+        return codes->update(tids, boost::any(getCode(boost::any_cast<T>(newValue))));
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::remove(TID tid) {
+        return codes->remove(tid);
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::remove(PositionListPtr tids) {
+        return codes->remove(tids);
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::clearContent() {
+        dictionary.clear();
+        dictionaryValues.clear();
+        return codes->clearContent();
+    }
+
+    template<class T>
+    const PositionListPtr CascadedEncoding<T>::selectCodeRange(int firstCode, int lastCode) {
+        int maxCode = (int) dictionaryValues.size() - 1;
+        if (firstCode == lastCode) {
+            return codes->selection(boost::any(firstCode), EQUAL);
+        } else if (firstCode == 0 && lastCode == maxCode) {
+            PositionListPtr result_tids(new PositionList(codes->size()));
+            for (TID i = 0; i < result_tids->size(); i++) {
+                (*result_tids)[i] = i;
+            }
+            return result_tids;
+        } else if (firstCode == 0) {
+            return codes->selection(boost::any(lastCode + 1), LESSER);
+        } else if (lastCode == maxCode) {
+            return codes->selection(boost::any(firstCode - 1), GREATER);
+        }
+
+        //a range in the middle of the code domain is the intersection of both open ranges
+        PositionListPtr lower = codes->selection(boost::any(firstCode - 1), GREATER);
+        PositionListPtr upper = codes->selection(boost::any(lastCode + 1), LESSER);
+        PositionListPtr result_tids(new PositionList());
+        std::set_intersection(lower->begin(), lower->end(), upper->begin(), upper->end(), std::back_inserter(*result_tids));
+        return result_tids;
+    }
+
+    template<class T>
+    const PositionListPtr CascadedEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (T)) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        //evaluate the predicate once per distinct value
+        std::vector<char> matchingCodes(dictionaryValues.size(), 0);
+        int firstCode = (int) dictionaryValues.size();
+        int lastCode = -1;
+        unsigned int numberOfMatchingCodes = 0;
+        for (uint64_t code = 0; code < dictionaryValues.size(); code++) {
+            const T& dictionaryValue = dictionaryValues[code];
+            bool match = evaluatePredicate(dictionaryValue, value, comp);
+            if (match) {
+                matchingCodes[code] = 1;
+                firstCode = std::min(firstCode, (int) code);
+                lastCode = std::max(lastCode, (int) code);
+                numberOfMatchingCodes++;
+            }
+        }
+
+        if (numberOfMatchingCodes == 0) {
+            return PositionListPtr(new PositionList());
+        }
+        //contiguous codes are evaluated by the code column itself
+        if (numberOfMatchingCodes == (unsigned int) (lastCode - firstCode + 1)) {
+            return selectCodeRange(firstCode, lastCode);
+        }
+
+        //otherwise the codes are decoded in batches and every code is looked up in the table of matching codes
+        PositionListPtr result_tids(new PositionList(codes->size()));
+        size_t numberOfResults = 0;
+        typename ColumnBaseTyped<int>::ColumnCursorPtr codeCursor = codes->createCursor();
+        std::vector<int> decodedCodes(DECODE_BATCH_SIZE);
+        for (TID begin = 0; begin < codes->size(); begin += DECODE_BATCH_SIZE) {
+            size_t count = std::min((size_t) DECODE_BATCH_SIZE, codes->size() - begin);
+            codeCursor->nextBatch(&decodedCodes[0], count);
+            for (size_t i = 0; i < count; i++) {
+                (*result_tids)[numberOfResults] = begin + i;
+                numberOfResults += matchingCodes[decodedCodes[i]];
+            }
+        }
+        result_tids->resize(numberOfResults);
+        return result_tids;
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        int encoding = codeEncoding;
+        oa << encoding;
+        oa << dictionaryValues;
+
+        outfile.flush();
+        outfile.close();
+        return codes->store(path_);
+    }
+
+    template<class T>
+    bool CascadedEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        int encoding;
+        ia >> encoding;
+        ia >> dictionaryValues;
+        infile.close();
+
+        //the dictionary map is rebuilt from the values, the code column is recreated with the stored encoding
+        dictionary.clear();
+        for (uint64_t code = 0; code < dictionaryValues.size(); code++) {
+            dictionary.insert(std::make_pair(dictionaryValues[code], (int) code));
+        }
+        codeEncoding = (CodeEncoding) encoding;
+        codes = createCodeColumn(this->name_ + "_codes", codeEncoding);
+        return codes->load(path_);
+    }
+
+    template<class T>
+    T& CascadedEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((size_t) tid < codes->size()) {
+            t = dictionaryValues[(*codes)[tid]];
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int CascadedEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = sizeof (codeEncoding);
+        size_in_bytes += dictionaryValues.capacity() * sizeof (T);
+        size_in_bytes += dictionary.size() * (sizeof (T) + sizeof (int));
+        size_in_bytes += codes->getSizeinBytes();
+        return size_in_bytes;
+    }
+
+    template<class T>
+    CascadedEncoding<T>::Cursor::Cursor(CascadedEncoding<T>& column) : ColumnCursor<T>(column.size()), column(column), codeCursor(column.codes->createCursor()) {
+
+    }
+
+    template<class T>
+    void CascadedEncoding<T>::Cursor::decodeNext(TID begin, size_t count, T* out) {
+        codeCursor->skipTo(begin);
+        for (size_t i = 0; i < count; i++) {
+            out[i] = column.dictionaryValues[codeCursor->next()];
+        }
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
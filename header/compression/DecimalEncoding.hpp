@@ -0,0 +1,695 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <compression/BitPacking.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a decimal compressed column of floating point values with type T (float or double).
+     *  \details   Values are grouped in blocks of BitPacking::BLOCK_SIZE values. Each block picks a decimal exponent e, so that its values
+     *             are stored as integers v * 10^e, which are compressed with frame of reference and bit packing. Values that do not
+     *             survive the conversion exactly (too many decimal places, NaN, out of range) are kept as exceptions of the block.
+     *             Selections and sum() work on the scaled integers and only look at the exceptions separately.
+     *             Values that do not fill a complete block yet are kept uncompressed until the block is full.
+     */
+    template<class T>
+    class DecimalEncoding : public CompressedColumn<T> {
+    public:
+        /*! \brief largest decimal exponent a block may use*/
+        static const unsigned int MAX_EXPONENT = 9;
+
+        /***************** constructors and destructor *****************/
+        DecimalEncoding(const std::string& name, AttributeType db_type);
+        virtual ~DecimalEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief unpacks and scales the blocks covering the range, complete blocks are unpacked in place*/
+        virtual void decode(TID begin, size_t count, T* out);
+
+        /*! \brief filters the column on the scaled integers, the comparison value is translated into an integer range per block*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+        /*! \brief returns the sum of all values, which is computed exactly on the scaled integers of each block*/
+        double sum() const;
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+
+
+        virtual T& operator[](const int index);
+
+    private:
+
+        static double getPowerOfTen(unsigned int exponent);
+        /*converts a scaled integer back into a value*/
+        static T decodeScaled(int64_t scaled, unsigned int exponent);
+        /*returns true and the scaled integer if value survives the conversion with the given exponent*/
+        static bool encodeScaled(const T& value, unsigned int exponent, int64_t& scaled);
+        /*returns the smallest scaled integer whose value is not less (upper=false) or greater (upper=true) than value*/
+        static int64_t findScaledBound(const T& value, unsigned int exponent, bool upper);
+
+        /*chooses the exponent of a block and computes its packed differences and exceptions, returns the needed bit width*/
+        unsigned int encodeBlock(const T* values, unsigned char& exponent, int32_t& minimum, uint32_t* differences,
+                std::vector<unsigned char>& positions, std::vector<T>& exceptions) const;
+        /*appends a complete block of values*/
+        void packBlock(const T* values);
+        /*replaces the packed values and exceptions of an existing block*/
+        void repackBlock(uint64_t blockIndex, const T* values);
+        /*decodes a complete block into values*/
+        void unpackBlock(uint64_t blockIndex, T* values) const;
+        /*removes all blocks starting at blockIndex and returns their values followed by the uncompressed tail*/
+        void truncate(uint64_t blockIndex, std::vector<T>& values);
+        /*returns the index of the first exception of a block and the index behind its last exception*/
+        void getExceptionRange(uint64_t blockIndex, uint32_t& begin, uint32_t& end) const;
+
+        const T getValue(TID tid) const;
+
+        /*compressed values structure*/
+        /*vector<[DECIMAL_EXPONENT]>*/
+        std::vector<unsigned char> blockExponents;
+        /*vector<[MINIMUM_SCALED_INTEGER]>*/
+        std::vector<int32_t> blockMinimums;
+        /*vector<[BLOCK_BIT_WIDTH]>*/
+        std::vector<unsigned char> blockBitWidths;
+        /*vector<[WORD_OFFSET_OF_BLOCK]>*/
+        std::vector<uint32_t> blockOffsets;
+        /*bit packed differences of all blocks, followed by a zero guard word*/
+        std::vector<uint64_t> packedValues;
+        /*vector<[INDEX_OF_FIRST_EXCEPTION_OF_BLOCK]>*/
+        std::vector<uint32_t> blockExceptionOffsets;
+        /*vector<[POSITION_IN_BLOCK]>, sorted ascending per block*/
+        std::vector<unsigned char> exceptionPositions;
+        /*vector<[VALUE]>*/
+        std::vector<T> exceptionValues;
+        /*values of the last, incomplete block*/
+        std::vector<T> uncompressedTail;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    DecimalEncoding<T>::DecimalEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type) {
+
+    }
+
+    template<class T>
+    DecimalEncoding<T>::~DecimalEncoding() {
+
+    }
+
+    template<class T>
+    double DecimalEncoding<T>::getPowerOfTen(unsigned int exponent) {
+        static const double powers[MAX_EXPONENT + 1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+        return powers[exponent];
+    }
+
+    template<class T>
+    T DecimalEncoding<T>::decodeScaled(int64_t scaled, unsigned int exponent) {
+        //powers of ten are exact doubles, so the division is correctly rounded
+        return (T) ((double) scaled / getPowerOfTen(exponent));
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::encodeScaled(const T& value, unsigned int exponent, int64_t& scaled) {
+        double product = (double) value * getPowerOfTen(exponent);
+        //also rejects NaN and infinity
+        if (!(product >= -2147483648.0 && product <= 2147483647.0)) {
+            return false;
+        }
+        scaled = (int64_t) std::floor(product + 0.5);
+        T decoded = decodeScaled(scaled, exponent);
+        //compare the bit patterns, so that -0.0 is kept as exception
+        return std::memcmp(&decoded, &value, sizeof (T)) == 0;
+    }
+
+    template<class T>
+    int64_t DecimalEncoding<T>::findScaledBound(const T& value, unsigned int exponent, bool upper) {
+        const int64_t lowest = -2147483648LL;
+        const int64_t highest = 2147483648LL;
+        double product = std::ceil((double) value * getPowerOfTen(exponent));
+        int64_t bound = (product < lowest) ? lowest : (product > highest) ? highest : (int64_t) product;
+        //correct rounding errors of the scaled comparison value
+        while (bound > lowest && (upper ? decodeScaled(bound - 1, exponent) > value : !(decodeScaled(bound - 1, exponent) < value))) {
+            bound--;
+        }
+        while (bound < highest && !(upper ? decodeScaled(bound, exponent) > value : !(decodeScaled(bound, exponent) < value))) {
+            bound++;
+        }
+        return bound;
+    }
+
+    template<class T>
+    unsigned int DecimalEncoding<T>::encodeBlock(const T* values, unsigned char& exponent, int32_t& minimum, uint32_t* differences,
+            std::vector<unsigned char>& positions, std::vector<T>& exceptions) const {
+        int64_t scaled[BitPacking::BLOCK_SIZE];
+        bool encodable[BitPacking::BLOCK_SIZE];
+        uint64_t bestCost = 0;
+        unsigned int bestBits = 0;
+
+        //pick the exponent with the smallest size of packed values plus exceptions
+        for (unsigned int e = 0; e <= MAX_EXPONENT; e++) {
+            int64_t currentMinimum = 0;
+            int64_t currentMaximum = 0;
+            unsigned int numberOfExceptions = 0;
+            for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+                encodable[i] = encodeScaled(values[i], e, scaled[i]);
+                if (!encodable[i]) {
+                    numberOfExceptions++;
+                } else if (numberOfExceptions == i) {
+                    //first encodable value of the block
+                    currentMinimum = currentMaximum = scaled[i];
+                } else {
+                    currentMinimum = std::min(currentMinimum, scaled[i]);
+                    currentMaximum = std::max(currentMaximum, scaled[i]);
+                }
+            }
+            unsigned int bits = BitPacking::getNeededBits((uint32_t) (currentMaximum - currentMinimum));
+            uint64_t cost = uint64_t(bits) * BitPacking::BLOCK_SIZE + uint64_t(numberOfExceptions) * (8 + 8 * sizeof (T));
+            if (e == 0 || cost < bestCost) {
+                bestCost = cost;
+                bestBits = bits;
+                exponent = e;
+            }
+        }
+
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            encodable[i] = encodeScaled(values[i], exponent, scaled[i]);
+        }
+        minimum = 0;
+        bool minimumFound = false;
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            if (encodable[i] && (!minimumFound || scaled[i] < minimum)) {
+                minimum = (int32_t) scaled[i];
+                minimumFound = true;
+            }
+        }
+        //exceptions keep a difference of 0 in the packed values
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            if (encodable[i]) {
+                differences[i] = (uint32_t) (scaled[i] - minimum);
+            } else {
+                differences[i] = 0;
+                positions.push_back(i);
+                exceptions.push_back(values[i]);
+            }
+        }
+        return bestBits;
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::packBlock(const T* values) {
+        unsigned char exponent;
+        int32_t minimum;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        blockExceptionOffsets.push_back(exceptionPositions.size());
+        unsigned int bits = encodeBlock(values, exponent, minimum, differences, exceptionPositions, exceptionValues);
+
+        //the new block starts at the position of the current guard word
+        uint32_t offset = packedValues.empty() ? 0 : packedValues.size() - 1;
+        packedValues.resize(offset + bits + 1, 0);
+        BitPacking::packBlock(differences, bits, &packedValues[offset]);
+        packedValues.back() = 0;
+
+        blockExponents.push_back(exponent);
+        blockMinimums.push_back(minimum);
+        blockBitWidths.push_back(bits);
+        blockOffsets.push_back(offset);
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::repackBlock(uint64_t blockIndex, const T* values) {
+        unsigned char exponent;
+        int32_t minimum;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        std::vector<unsigned char> positions;
+        std::vector<T> exceptions;
+        unsigned int bits = encodeBlock(values, exponent, minimum, differences, positions, exceptions);
+        unsigned int oldBits = blockBitWidths[blockIndex];
+        uint32_t offset = blockOffsets[blockIndex];
+
+        //resize the word range of the block and move all following blocks accordingly
+        if (bits > oldBits) {
+            packedValues.insert(packedValues.begin() + offset + oldBits, bits - oldBits, 0);
+        } else if (bits < oldBits) {
+            packedValues.erase(packedValues.begin() + offset + bits, packedValues.begin() + offset + oldBits);
+        }
+        for (uint64_t i = blockIndex + 1; i < blockOffsets.size(); i++) {
+            blockOffsets[i] = blockOffsets[i] + bits - oldBits;
+        }
+        BitPacking::packBlock(differences, bits, &packedValues[offset]);
+
+        //replace the exceptions of the block
+        uint32_t begin, end;
+        getExceptionRange(blockIndex, begin, end);
+        exceptionPositions.erase(exceptionPositions.begin() + begin, exceptionPositions.begin() + end);
+        exceptionPositions.insert(exceptionPositions.begin() + begin, positions.begin(), positions.end());
+        exceptionValues.erase(exceptionValues.begin() + begin, exceptionValues.begin() + end);
+        exceptionValues.insert(exceptionValues.begin() + begin, exceptions.begin(), exceptions.end());
+        for (uint64_t i = blockIndex + 1; i < blockExceptionOffsets.size(); i++) {
+            blockExceptionOffsets[i] = blockExceptionOffsets[i] + positions.size() - (end - begin);
+        }
+
+        blockExponents[blockIndex] = exponent;
+        blockMinimums[blockIndex] = minimum;
+        blockBitWidths[blockIndex] = bits;
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::getExceptionRange(uint64_t blockIndex, uint32_t& begin, uint32_t& end) const {
+        begin = blockExceptionOffsets[blockIndex];
+        end = (blockIndex + 1 < blockExceptionOffsets.size()) ? blockExceptionOffsets[blockIndex + 1] : exceptionPositions.size();
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::unpackBlock(uint64_t blockIndex, T* values) const {
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+        int64_t minimum = blockMinimums[blockIndex];
+        unsigned int exponent = blockExponents[blockIndex];
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            values[i] = decodeScaled(minimum + differences[i], exponent);
+        }
+        //patch the exceptions
+        uint32_t begin, end;
+        getExceptionRange(blockIndex, begin, end);
+        for (uint32_t i = begin; i < end; i++) {
+            values[exceptionPositions[i]] = exceptionValues[i];
+        }
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::truncate(uint64_t blockIndex, std::vector<T>& values) {
+        uint64_t numberOfBlocks = blockOffsets.size();
+        values.resize((numberOfBlocks - blockIndex) * BitPacking::BLOCK_SIZE);
+        for (uint64_t i = blockIndex; i < numberOfBlocks; i++) {
+            unpackBlock(i, &values[(i - blockIndex) * BitPacking::BLOCK_SIZE]);
+        }
+        values.insert(values.end(), uncompressedTail.begin(), uncompressedTail.end());
+
+        if (blockIndex < numberOfBlocks) {
+            packedValues.resize(blockOffsets[blockIndex] + 1);
+            packedValues.back() = 0;
+            exceptionPositions.resize(blockExceptionOffsets[blockIndex]);
+            exceptionValues.resize(blockExceptionOffsets[blockIndex]);
+        }
+        if (blockIndex == 0) {
+            packedValues.clear();
+        }
+        blockExponents.resize(blockIndex);
+        blockMinimums.resize(blockIndex);
+        blockBitWidths.resize(blockIndex);
+        blockOffsets.resize(blockIndex);
+        blockExceptionOffsets.resize(blockIndex);
+        uncompressedTail.clear();
+    }
+
+    template<class T>
+    const T DecimalEncoding<T>::getValue(TID tid) const {
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex >= blockOffsets.size()) {
+            return uncompressedTail[tid - blockOffsets.size() * BitPacking::BLOCK_SIZE];
+        }
+
+        unsigned char position = tid % BitPacking::BLOCK_SIZE;
+        uint32_t begin, end;
+        getExceptionRange(blockIndex, begin, end);
+        std::vector<unsigned char>::const_iterator exception = std::lower_bound(exceptionPositions.begin() + begin, exceptionPositions.begin() + end, position);
+        if (exception != exceptionPositions.begin() + end && *exception == position) {
+            return exceptionValues[exception - exceptionPositions.begin()];
+        }
+        uint32_t difference = BitPacking::extract(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], position);
+        return decodeScaled(int64_t(blockMinimums[blockIndex]) + difference, blockExponents[blockIndex]);
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::insert(const T& newValue) {
+        uncompressedTail.push_back(newValue);
+        //compress the tail as soon as it fills a complete block
+        if (uncompressedTail.size() == BitPacking::BLOCK_SIZE) {
+            packBlock(&uncompressedTail[0]);
+            uncompressedTail.clear();
+        }
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool DecimalEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any DecimalEncoding<T>::get(TID tid) {
+        if (tid < this->size()) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        for (TID i = 0; i < this->size(); i++) {
+            std::cout << "| " << getValue(i) << " |" << std::endl;
+        }
+    }
+
+    template<class T>
+    size_t DecimalEncoding<T>::size() const throw () {
+        return blockOffsets.size() * BitPacking::BLOCK_SIZE + uncompressedTail.size();
+    }
+
+    template<class T>
+    const ColumnPtr DecimalEncoding<T>::copy() const {
+        return ColumnPtr(new DecimalEncoding<T>(*this));
+    }
+
+    template<class T>
+    void DecimalEncoding<T>::decode(TID begin, size_t count, T* out) {
+        BitPacking::decodeBlocks(*this, &DecimalEncoding<T>::unpackBlock, blockOffsets.size(), uncompressedTail, begin, count, out);
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= this->size()) {
+            return false;
+        }
+        T value = boost::any_cast<T>(newValue);
+
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex == blockOffsets.size()) {
+            uncompressedTail[tid % BitPacking::BLOCK_SIZE] = value;
+            return true;
+        }
+
+        //decode the block, change the value and pack the block again
+        T values[BitPacking::BLOCK_SIZE];
+        unpackBlock(blockIndex, values);
+        values[tid % BitPacking::BLOCK_SIZE] = value;
+        repackBlock(blockIndex, values);
+        return true;
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of tid on and compress them again without the removed value
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+        values.erase(values.begin() + (tid - blockIndex * BitPacking::BLOCK_SIZE));
+        return this->insert(values.begin(), values.end());
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || this->size() == 0) {
+            return false;
+        }
+        if (tids->back() >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of the first tid on and compress them again without the removed values
+        uint64_t blockIndex = tids->front() / BitPacking::BLOCK_SIZE;
+        TID base = blockIndex * BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+
+        std::vector<T> remainingValues;
+        remainingValues.reserve(values.size());
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = 0; i < values.size(); i++) {
+            if (it != tids->end() && *it == base + i) {
+                ++it;
+            } else {
+                remainingValues.push_back(values[i]);
+            }
+        }
+        return this->insert(remainingValues.begin(), remainingValues.end());
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::clearContent() {
+        blockExponents.clear();
+        blockMinimums.clear();
+        blockBitWidths.clear();
+        blockOffsets.clear();
+        packedValues.clear();
+        blockExceptionOffsets.clear();
+        exceptionPositions.clear();
+        exceptionValues.clear();
+        uncompressedTail.clear();
+        return true;
+    }
+
+    template<class T>
+    const PositionListPtr DecimalEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        //prefix and substring predicates only apply to strings, the generic selection rejects them
+        if (value_for_comparison.type() != typeid (T) || comp == PREFIX || comp == SUBSTRING) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+        //no value compares to NaN
+        if (value != value) {
+            return result_tids;
+        }
+
+        //every comparator selects a range [lower,upper) of scaled integers, which depends on the exponent only
+        int64_t lowerBounds[MAX_EXPONENT + 1];
+        int64_t upperBounds[MAX_EXPONENT + 1];
+        for (unsigned int e = 0; e <= MAX_EXPONENT; e++) {
+            lowerBounds[e] = -2147483648LL;
+            upperBounds[e] = 2147483648LL;
+            if (comp == EQUAL) {
+                lowerBounds[e] = findScaledBound(value, e, false);
+                upperBounds[e] = findScaledBound(value, e, true);
+            } else if (comp == LESSER) {
+                upperBounds[e] = findScaledBound(value, e, false);
+            } else if (comp == GREATER) {
+                lowerBounds[e] = findScaledBound(value, e, true);
+            } else {
+                upperBounds[e] = lowerBounds[e];
+            }
+        }
+
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        for (uint64_t blockIndex = 0; blockIndex < blockOffsets.size(); blockIndex++) {
+            TID base = blockIndex * BitPacking::BLOCK_SIZE;
+            unsigned int exponent = blockExponents[blockIndex];
+
+            //translate the range into the difference domain of the block
+            int64_t maxDifference = BitPacking::getMaxValue(blockBitWidths[blockIndex]);
+            int64_t lower = std::max(lowerBounds[exponent] - blockMinimums[blockIndex], int64_t(0));
+            int64_t upper = std::min(upperBounds[exponent] - blockMinimums[blockIndex], maxDifference + 1);
+
+            uint64_t matches = 0;
+            if (lower == 0 && upper == maxDifference + 1) {
+                matches = ~uint64_t(0);
+            } else if (lower < upper) {
+                BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+                uint32_t rangeStart = lower;
+                uint32_t rangeWidth = upper - lower;
+                for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+                    matches |= uint64_t(differences[i] - rangeStart < rangeWidth) << i;
+                }
+            }
+
+            //exceptions are evaluated on their actual values
+            uint32_t begin, end;
+            getExceptionRange(blockIndex, begin, end);
+            for (uint32_t i = begin; i < end; i++) {
+                const T& exception = exceptionValues[i];
+                bool match = evaluatePredicate(exception, value, comp);
+                matches = (matches & ~(uint64_t(1) << exceptionPositions[i])) | (uint64_t(match) << exceptionPositions[i]);
+            }
+
+            while (matches != 0) {
+                result_tids->push_back(base + __builtin_ctzll(matches));
+                matches &= matches - 1;
+            }
+        }
+
+        //the values of the incomplete block are compared directly
+        TID base = blockOffsets.size() * BitPacking::BLOCK_SIZE;
+        for (TID i = 0; i < uncompressedTail.size(); i++) {
+            if (evaluatePredicate(uncompressedTail[i], value, comp)) {
+                result_tids->push_back(base + i);
+            }
+        }
+
+        return result_tids;
+    }
+
+    template<class T>
+    double DecimalEncoding<T>::sum() const {
+        double result = 0;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        for (uint64_t blockIndex = 0; blockIndex < blockOffsets.size(); blockIndex++) {
+            BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+            int64_t blockSum = 0;
+            for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+                blockSum += differences[i];
+            }
+
+            //exceptions occupy a difference of 0 and are added with their actual values
+            uint32_t begin, end;
+            getExceptionRange(blockIndex, begin, end);
+            blockSum += int64_t(blockMinimums[blockIndex]) * (BitPacking::BLOCK_SIZE - (end - begin));
+            result += (double) blockSum / getPowerOfTen(blockExponents[blockIndex]);
+            for (uint32_t i = begin; i < end; i++) {
+                result += exceptionValues[i];
+            }
+        }
+        for (uint64_t i = 0; i < uncompressedTail.size(); i++) {
+            result += uncompressedTail[i];
+        }
+        return result;
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << blockExponents;
+        oa << blockMinimums;
+        oa << blockBitWidths;
+        oa << blockOffsets;
+        oa << packedValues;
+        oa << blockExceptionOffsets;
+        oa << exceptionPositions;
+        oa << exceptionValues;
+        oa << uncompressedTail;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool DecimalEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> blockExponents;
+        ia >> blockMinimums;
+        ia >> blockBitWidths;
+        ia >> blockOffsets;
+        ia >> packedValues;
+        ia >> blockExceptionOffsets;
+        ia >> exceptionPositions;
+        ia >> exceptionValues;
+        ia >> uncompressedTail;
+
+        infile.close();
+        return true;
+    }
+
+    template<class T>
+    T& DecimalEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((size_t) tid < this->size()) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int DecimalEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = blockExponents.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockMinimums.capacity() * sizeof (int32_t);
+        size_in_bytes += blockBitWidths.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += packedValues.capacity() * sizeof (uint64_t);
+        size_in_bytes += blockExceptionOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += exceptionPositions.capacity() * sizeof (unsigned char);
+        size_in_bytes += exceptionValues.capacity() * sizeof (T);
+        size_in_bytes += uncompressedTail.capacity() * sizeof (T);
+        return size_in_bytes;
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
@@ -0,0 +1,620 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <compression/BitPacking.hpp>
+#include <algorithm>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a delta compressed column with type T.
+     *  \details   Values are grouped in blocks of BitPacking::BLOCK_SIZE values. Each block stores its first value as base and bit packs
+     *             either the differences between consecutive values (first order) or the differences between consecutive differences
+     *             (second order), whichever needs fewer bits. The packed sequence is stored relative to its minimum, so a constant step
+     *             like an auto increment key or a regular time stamp interval needs no bits at all.
+     *             While the column is sorted ascending, selections binary search the block bases instead of decoding the column.
+     *             T has to be an integral type of at most 32 bits.
+     */
+    template<class T>
+    class DeltaEncoding : public CompressedColumn<T> {
+    public:
+        /***************** constructors and destructor *****************/
+        DeltaEncoding(const std::string& name, AttributeType db_type);
+        virtual ~DeltaEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief reconstructs the blocks covering the range, each block is decoded once instead of once per value*/
+        virtual void decode(TID begin, size_t count, T* out);
+
+        /*! \brief filters the column, on sorted columns the result range is determined by a binary search over the block bases*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+        /*! \brief returns the flag maintained by the modifications, so the sorted check needs no scan*/
+        virtual bool isSorted();
+
+        virtual T& operator[](const int index);
+
+    private:
+
+        /*appends a complete block of values to the packed values*/
+        void packBlock(const T* values);
+        /*replaces the packed values of an existing block, which may change its bit width*/
+        void repackBlock(uint64_t blockIndex, const T* values);
+        /*decodes a complete block into values*/
+        void unpackBlock(uint64_t blockIndex, T* values) const;
+        /*removes all blocks starting at blockIndex and returns their values followed by the uncompressed tail*/
+        void truncate(uint64_t blockIndex, std::vector<T>& values);
+        /*chooses the delta order of a block and computes its packed sequence, returns the needed bit width*/
+        unsigned int computeDeltas(const T* values, unsigned char& order, uint32_t& reference, uint32_t& firstDelta, uint32_t* packed) const;
+        /*returns the first position whose value is not less (upper=false) or greater (upper=true) than value, requires a sorted column*/
+        TID findBound(const T& value, bool upper) const;
+
+        const T getValue(TID tid) const;
+
+        /*compressed values structure*/
+        /*vector<[FIRST_VALUE_OF_BLOCK]>*/
+        std::vector<T> blockBases;
+        /*vector<[DELTA_ORDER]>*/
+        std::vector<unsigned char> blockOrders;
+        /*vector<[MINIMUM_OF_PACKED_SEQUENCE]>*/
+        std::vector<uint32_t> blockReferences;
+        /*vector<[FIRST_DELTA]>, only used by second order blocks*/
+        std::vector<uint32_t> blockFirstDeltas;
+        /*vector<[BLOCK_BIT_WIDTH]>*/
+        std::vector<unsigned char> blockBitWidths;
+        /*vector<[WORD_OFFSET_OF_BLOCK]>*/
+        std::vector<uint32_t> blockOffsets;
+        /*bit packed sequences of all blocks, followed by a zero guard word*/
+        std::vector<uint64_t> packedValues;
+        /*values of the last, incomplete block*/
+        std::vector<T> uncompressedTail;
+        /*true as long as the values are sorted ascending*/
+        bool sorted;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    DeltaEncoding<T>::DeltaEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type), sorted(true) {
+
+    }
+
+    template<class T>
+    DeltaEncoding<T>::~DeltaEncoding() {
+
+    }
+
+    template<class T>
+    unsigned int DeltaEncoding<T>::computeDeltas(const T* values, unsigned char& order, uint32_t& reference, uint32_t& firstDelta, uint32_t* packed) const {
+        uint32_t deltas[BitPacking::BLOCK_SIZE];
+        uint32_t deltasOfDeltas[BitPacking::BLOCK_SIZE];
+        deltas[0] = 0;
+        deltasOfDeltas[0] = deltasOfDeltas[1] = 0;
+
+        //differences are computed modulo 2^32 and interpreted as signed values to find the minimum
+        int32_t minimumDelta = (uint32_t) values[1] - (uint32_t) values[0];
+        int32_t minimumDeltaOfDeltas = 0;
+        for (unsigned int i = 1; i < BitPacking::BLOCK_SIZE; i++) {
+            deltas[i] = (uint32_t) values[i] - (uint32_t) values[i - 1];
+            minimumDelta = std::min(minimumDelta, (int32_t) deltas[i]);
+            if (i >= 2) {
+                deltasOfDeltas[i] = deltas[i] - deltas[i - 1];
+                minimumDeltaOfDeltas = (i == 2) ? (int32_t) deltasOfDeltas[i] : std::min(minimumDeltaOfDeltas, (int32_t) deltasOfDeltas[i]);
+            }
+        }
+
+        //store both sequences relative to their minimum, unused leading positions become 0
+        for (unsigned int i = 1; i < BitPacking::BLOCK_SIZE; i++) {
+            deltas[i] -= (uint32_t) minimumDelta;
+            if (i >= 2) {
+                deltasOfDeltas[i] -= (uint32_t) minimumDeltaOfDeltas;
+            }
+        }
+        unsigned int firstOrderBits = BitPacking::getMaxBits(deltas, BitPacking::BLOCK_SIZE);
+        unsigned int secondOrderBits = BitPacking::getMaxBits(deltasOfDeltas, BitPacking::BLOCK_SIZE);
+
+        const uint32_t* sequence;
+        unsigned int bits;
+        if (secondOrderBits < firstOrderBits) {
+            order = 2;
+            reference = (uint32_t) minimumDeltaOfDeltas;
+            firstDelta = (uint32_t) values[1] - (uint32_t) values[0];
+            sequence = deltasOfDeltas;
+            bits = secondOrderBits;
+        } else {
+            order = 1;
+            reference = (uint32_t) minimumDelta;
+            firstDelta = 0;
+            sequence = deltas;
+            bits = firstOrderBits;
+        }
+        std::copy(sequence, sequence + BitPacking::BLOCK_SIZE, packed);
+        return bits;
+    }
+
+    template<class T>
+    void DeltaEncoding<T>::packBlock(const T* values) {
+        unsigned char order;
+        uint32_t reference, firstDelta;
+        uint32_t packed[BitPacking::BLOCK_SIZE];
+        unsigned int bits = computeDeltas(values, order, reference, firstDelta, packed);
+
+        //the new block starts at the position of the current guard word
+        uint32_t offset = packedValues.empty() ? 0 : packedValues.size() - 1;
+        packedValues.resize(offset + bits + 1, 0);
+        BitPacking::packBlock(packed, bits, &packedValues[offset]);
+        packedValues.back() = 0;
+
+        blockBases.push_back(values[0]);
+        blockOrders.push_back(order);
+        blockReferences.push_back(reference);
+        blockFirstDeltas.push_back(firstDelta);
+        blockBitWidths.push_back(bits);
+        blockOffsets.push_back(offset);
+    }
+
+    template<class T>
+    void DeltaEncoding<T>::repackBlock(uint64_t blockIndex, const T* values) {
+        unsigned char order;
+        uint32_t reference, firstDelta;
+        uint32_t packed[BitPacking::BLOCK_SIZE];
+        unsigned int bits = computeDeltas(values, order, reference, firstDelta, packed);
+        unsigned int oldBits = blockBitWidths[blockIndex];
+        uint32_t offset = blockOffsets[blockIndex];
+
+        //resize the word range of the block and move all following blocks accordingly
+        if (bits > oldBits) {
+            packedValues.insert(packedValues.begin() + offset + oldBits, bits - oldBits, 0);
+        } else if (bits < oldBits) {
+            packedValues.erase(packedValues.begin() + offset + bits, packedValues.begin() + offset + oldBits);
+        }
+        for (uint64_t i = blockIndex + 1; i < blockOffsets.size(); i++) {
+            blockOffsets[i] = blockOffsets[i] + bits - oldBits;
+        }
+
+        BitPacking::packBlock(packed, bits, &packedValues[offset]);
+        blockBases[blockIndex] = values[0];
+        blockOrders[blockIndex] = order;
+        blockReferences[blockIndex] = reference;
+        blockFirstDeltas[blockIndex] = firstDelta;
+        blockBitWidths[blockIndex] = bits;
+    }
+
+    template<class T>
+    void DeltaEncoding<T>::unpackBlock(uint64_t blockIndex, T* values) const {
+        uint32_t packed[BitPacking::BLOCK_SIZE];
+        BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], packed);
+
+        uint32_t reference = blockReferences[blockIndex];
+        uint32_t value = (uint32_t) blockBases[blockIndex];
+        values[0] = blockBases[blockIndex];
+        if (blockOrders[blockIndex] == 1) {
+            for (unsigned int i = 1; i < BitPacking::BLOCK_SIZE; i++) {
+                value += packed[i] + reference;
+                values[i] = (T) value;
+            }
+        } else {
+            uint32_t delta = blockFirstDeltas[blockIndex];
+            value += delta;
+            values[1] = (T) value;
+            for (unsigned int i = 2; i < BitPacking::BLOCK_SIZE; i++) {
+                delta += packed[i] + reference;
+                value += delta;
+                values[i] = (T) value;
+            }
+        }
+    }
+
+    template<class T>
+    void DeltaEncoding<T>::truncate(uint64_t blockIndex, std::vector<T>& values) {
+        uint64_t numberOfBlocks = blockBases.size();
+        values.resize((numberOfBlocks - blockIndex) * BitPacking::BLOCK_SIZE);
+        for (uint64_t i = blockIndex; i < numberOfBlocks; i++) {
+            unpackBlock(i, &values[(i - blockIndex) * BitPacking::BLOCK_SIZE]);
+        }
+        values.insert(values.end(), uncompressedTail.begin(), uncompressedTail.end());
+
+        if (blockIndex < numberOfBlocks) {
+            packedValues.resize(blockOffsets[blockIndex] + 1);
+            packedValues.back() = 0;
+        }
+        if (blockIndex == 0) {
+            packedValues.clear();
+        }
+        blockBases.resize(blockIndex);
+        blockOrders.resize(blockIndex);
+        blockReferences.resize(blockIndex);
+        blockFirstDeltas.resize(blockIndex);
+        blockBitWidths.resize(blockIndex);
+        blockOffsets.resize(blockIndex);
+        uncompressedTail.clear();
+    }
+
+    template<class T>
+    const T DeltaEncoding<T>::getValue(TID tid) const {
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex < blockBases.size()) {
+            T values[BitPacking::BLOCK_SIZE];
+            unpackBlock(blockIndex, values);
+            return values[tid % BitPacking::BLOCK_SIZE];
+        }
+        return uncompressedTail[tid - blockBases.size() * BitPacking::BLOCK_SIZE];
+    }
+
+    template<class T>
+    TID DeltaEncoding<T>::findBound(const T& value, bool upper) const {
+        //the first block whose base is not less (greater) than value, the bound lies in the block before it or at its start
+        typename std::vector<T>::const_iterator it = upper
+                ? std::upper_bound(blockBases.begin(), blockBases.end(), value)
+                : std::lower_bound(blockBases.begin(), blockBases.end(), value);
+        uint64_t blockIndex = it - blockBases.begin();
+
+        if (blockIndex > 0) {
+            T values[BitPacking::BLOCK_SIZE];
+            unpackBlock(blockIndex - 1, values);
+            T* bound = upper
+                    ? std::upper_bound(values, values + BitPacking::BLOCK_SIZE, value)
+                    : std::lower_bound(values, values + BitPacking::BLOCK_SIZE, value);
+            if (bound != values + BitPacking::BLOCK_SIZE) {
+                return (blockIndex - 1) * BitPacking::BLOCK_SIZE + (bound - values);
+            }
+        }
+        if (blockIndex < blockBases.size()) {
+            return blockIndex * BitPacking::BLOCK_SIZE;
+        }
+
+        typename std::vector<T>::const_iterator bound = upper
+                ? std::upper_bound(uncompressedTail.begin(), uncompressedTail.end(), value)
+                : std::lower_bound(uncompressedTail.begin(), uncompressedTail.end(), value);
+        return blockBases.size() * BitPacking::BLOCK_SIZE + (bound - uncompressedTail.begin());
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::isSorted() {
+        return sorted;
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::insert(const T& newValue) {
+        if (sorted && this->size() > 0) {
+            T lastValue = uncompressedTail.empty() ? getValue(this->size() - 1) : uncompressedTail.back();
+            sorted = !(newValue < lastValue);
+        }
+
+        uncompressedTail.push_back(newValue);
+        //compress the tail as soon as it fills a complete block
+        if (uncompressedTail.size() == BitPacking::BLOCK_SIZE) {
+            packBlock(&uncompressedTail[0]);
+            uncompressedTail.clear();
+        }
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool DeltaEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any DeltaEncoding<T>::get(TID tid) {
+        if (tid < this->size()) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void DeltaEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        T values[BitPacking::BLOCK_SIZE];
+        for (uint64_t i = 0; i < blockBases.size(); i++) {
+            unpackBlock(i, values);
+            for (unsigned int j = 0; j < BitPacking::BLOCK_SIZE; j++) {
+                std::cout << "| " << values[j] << " |" << std::endl;
+            }
+        }
+        for (uint64_t i = 0; i < uncompressedTail.size(); i++) {
+            std::cout << "| " << uncompressedTail[i] << " |" << std::endl;
+        }
+    }
+
+    template<class T>
+    size_t DeltaEncoding<T>::size() const throw () {
+        return blockBases.size() * BitPacking::BLOCK_SIZE + uncompressedTail.size();
+    }
+
+    template<class T>
+    const ColumnPtr DeltaEncoding<T>::copy() const {
+        return ColumnPtr(new DeltaEncoding<T>(*this));
+    }
+
+    template<class T>
+    void DeltaEncoding<T>::decode(TID begin, size_t count, T* out) {
+        BitPacking::decodeBlocks(*this, &DeltaEncoding<T>::unpackBlock, blockBases.size(), uncompressedTail, begin, count, out);
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= this->size()) {
+            return false;
+        }
+        T value = boost::any_cast<T>(newValue);
+
+        //the column stays sorted if the new value fits between its neighbours
+        if (sorted) {
+            sorted = (tid == 0 || !(value < getValue(tid - 1)))
+                    && (tid + 1 == this->size() || !(getValue(tid + 1) < value));
+        }
+
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex == blockBases.size()) {
+            uncompressedTail[tid % BitPacking::BLOCK_SIZE] = value;
+            return true;
+        }
+
+        //decode the block, change the value and pack the block again
+        T values[BitPacking::BLOCK_SIZE];
+        unpackBlock(blockIndex, values);
+        values[tid % BitPacking::BLOCK_SIZE] = value;
+        repackBlock(blockIndex, values);
+        return true;
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of tid on and compress them again without the removed value
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+        values.erase(values.begin() + (tid - blockIndex * BitPacking::BLOCK_SIZE));
+        return this->insert(values.begin(), values.end());
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || this->size() == 0) {
+            return false;
+        }
+        if (tids->back() >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of the first tid on and compress them again without the removed values
+        uint64_t blockIndex = tids->front() / BitPacking::BLOCK_SIZE;
+        TID base = blockIndex * BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+
+        std::vector<T> remainingValues;
+        remainingValues.reserve(values.size());
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = 0; i < values.size(); i++) {
+            if (it != tids->end() && *it == base + i) {
+                ++it;
+            } else {
+                remainingValues.push_back(values[i]);
+            }
+        }
+        return this->insert(remainingValues.begin(), remainingValues.end());
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::clearContent() {
+        blockBases.clear();
+        blockOrders.clear();
+        blockReferences.clear();
+        blockFirstDeltas.clear();
+        blockBitWidths.clear();
+        blockOffsets.clear();
+        packedValues.clear();
+        uncompressedTail.clear();
+        sorted = true;
+        return true;
+    }
+
+    template<class T>
+    const PositionListPtr DeltaEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        //prefix and substring predicates only apply to strings, the generic selection rejects them
+        if (value_for_comparison.type() != typeid (T) || comp == PREFIX || comp == SUBSTRING) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+
+        if (sorted) {
+            //on sorted data every predicate selects a contiguous tid range
+            TID begin = 0;
+            TID end = this->size();
+            if (comp == EQUAL) {
+                begin = findBound(value, false);
+                end = findBound(value, true);
+            } else if (comp == LESSER) {
+                end = findBound(value, false);
+            } else if (comp == GREATER) {
+                begin = findBound(value, true);
+            } else {
+                end = begin;
+            }
+            result_tids->reserve(end - begin);
+            for (TID i = begin; i < end; i++) {
+                result_tids->push_back(i);
+            }
+            return result_tids;
+        }
+
+        T values[BitPacking::BLOCK_SIZE];
+        for (uint64_t blockIndex = 0; blockIndex <= blockBases.size(); blockIndex++) {
+            TID base = blockIndex * BitPacking::BLOCK_SIZE;
+            const T* block = values;
+            unsigned int blockSize = BitPacking::BLOCK_SIZE;
+            if (blockIndex < blockBases.size()) {
+                unpackBlock(blockIndex, values);
+            } else {
+                //the values of the incomplete block are compared directly
+                if (uncompressedTail.empty()) {
+                    break;
+                }
+                block = &uncompressedTail[0];
+                blockSize = uncompressedTail.size();
+            }
+
+            size_t numberOfResults = result_tids->size();
+            result_tids->resize(numberOfResults + blockSize);
+            TID* out = &(*result_tids)[numberOfResults];
+            unsigned int numberOfMatches = 0;
+            //predicated store, every tid is written and only matches advance the output position
+            for (unsigned int i = 0; i < blockSize; i++) {
+                out[numberOfMatches] = base + i;
+                numberOfMatches += evaluatePredicate(block[i], value, comp);
+            }
+            result_tids->resize(numberOfResults + numberOfMatches);
+        }
+
+        return result_tids;
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << blockBases;
+        oa << blockOrders;
+        oa << blockReferences;
+        oa << blockFirstDeltas;
+        oa << blockBitWidths;
+        oa << blockOffsets;
+        oa << packedValues;
+        oa << uncompressedTail;
+        oa << sorted;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool DeltaEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> blockBases;
+        ia >> blockOrders;
+        ia >> blockReferences;
+        ia >> blockFirstDeltas;
+        ia >> blockBitWidths;
+        ia >> blockOffsets;
+        ia >> packedValues;
+        ia >> uncompressedTail;
+        ia >> sorted;
+
+        infile.close();
+        return true;
+    }
+
+    template<class T>
+    T& DeltaEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((size_t) tid < this->size()) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int DeltaEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = blockBases.capacity() * sizeof (T);
+        size_in_bytes += blockOrders.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockReferences.capacity() * sizeof (uint32_t);
+        size_in_bytes += blockFirstDeltas.capacity() * sizeof (uint32_t);
+        size_in_bytes += blockBitWidths.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += packedValues.capacity() * sizeof (uint64_t);
+        size_in_bytes += uncompressedTail.capacity() * sizeof (T);
+        return size_in_bytes;
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
@@ -37,6 +37,35 @@ namespace CoGaDB {
 
         virtual const ColumnPtr copy() const;
 
+        /*! \brief translates the codes of the range through the table of values by code number*/
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief returns a cursor that translates the codes through the table of values by code number*/
+        virtual typename ColumnBaseTyped<T>::ColumnCursorPtr createCursor();
+        /*! \brief translates the codes of the TIDs with a table of values by code number and prefetches the codes of unsorted lists*/
+        virtual void gather(const PositionList& tids, T* out);
+        /*! \brief counting sort over the codes, which are ranked by the order of their values in the dictionary, O(rows + distinct values)*/
+        virtual const PositionListPtr sort(SortOrder order);
+
+        /*! \brief joins two dictionary encoded columns on their codes, other columns are joined by the generic hash join
+         * \details The codes of both dictionaries are matched by merging the ordered dictionaries, O(distinct values). The TIDs of
+         * join_column are grouped by code with a counting sort, so every code of this column finds its matches by an array lookup.
+         * The pairs are ordered by the TIDs of this column and the TIDs of join_column.
+         * */
+        virtual const PositionListPairPtr hash_join(ColumnPtr join_column);
+        /*! \brief dictionary encoded columns join each other with hash_join() on their codes*/
+        virtual bool hasCompressedJoin(ColumnBaseTyped<T>& join_column, JoinAlgorithm& algorithm);
+        /*! \brief returns the size of the dictionary*/
+        virtual size_t getNumberOfDistinctValues();
+        /*! \brief tests every distinct value once against the filter and scans the codes for the passing ones*/
+        virtual const PositionListPtr filter_selection(const JoinFilter<T>& filter);
+        /*! \brief transforms the values of the dictionary and keeps the codes, O(distinct values)
+         * \details returns false if two values are transformed to the same value, e.g., by a multiplication with zero
+         * */
+        virtual bool transformValues(ArithmeticOperation operation, const T& constant);
+
+        /*! \brief evaluates the predicate once per distinct value and scans the codes for the matching ones*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
         virtual bool store(const std::string& path);
         virtual bool load(const std::string& path);
 
@@ -46,22 +75,44 @@ namespace CoGaDB {
 
 
 
+        /*! \brief returns a reference to a copy of the value, writes have to use update()*/
         virtual T& operator[](const int index);
 
     private:
 
+        //returns the number that is represented by a dictionaryCode
+        static uint64_t getCodeNumber(const std::vector<bool>& dictionaryCode);
+        //inserts the value with a new dictionaryCode into the dictionary, if it is not already there
+        void insertIntoDictionary(const T& value);
+        //rebuilds valuesByCodeNumber from the dictionary, after the dictionary was replaced
+        void rebuildValuesByCodeNumber();
+
+        /*cursor over the dictionary codes, which translates them with the table of values by code number*/
+        class Cursor : public ColumnCursor<T> {
+        public:
+            Cursor(const DictionaryEncoding<T>& column);
+
+        protected:
+            virtual void decodeNext(TID begin, size_t count, T* out);
+
+        private:
+            const DictionaryEncoding<T>& column;
+        };
+
         /*compressed values structure*/
         /*map<[VALUE],[DICTIONARY_CODE]>*/
         std::map<T, std::vector<bool> > dictionary;
         /*vector<[DICTIONARY_CODE]>*/
         std::vector<std::vector<bool> > encodedValues;
+        /*vector<[VALUE]>, indexed by the number of the dictionaryCode, so decoding never searches the dictionary*/
+        std::vector<T> valuesByCodeNumber;
     };
 
     /***************** Start of Implementation Section ******************/
 
 
     template<class T>
-    DictionaryEncoding<T>::DictionaryEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type) {
+    DictionaryEncoding<T>::DictionaryEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type), dictionary(), encodedValues(), valuesByCodeNumber() {
 
     }
 
@@ -111,7 +162,7 @@ namespace CoGaDB {
         T value = boost::any_cast<T>(newValue);
 
         //insert the value along with its dictionaryCode into the dictionary map(if not already there)
-        dictionary.insert(std::make_pair(value, getNewDictionaryCode()));
+        insertIntoDictionary(value);
         //sort and update values here
 
         //insert the dictionaryCode of the given value into the encodedValues column
@@ -126,7 +177,7 @@ namespace CoGaDB {
         T value = newValue;
 
         //insert the value along with its dictionaryCode into the dictionary map(if not already there)
-        dictionary.insert(std::make_pair(value, getNewDictionaryCode()));
+        insertIntoDictionary(value);
         //sort and update values here
 
         //insert the dictionaryCode of the given value into the encodedValues column
@@ -190,6 +241,28 @@ namespace CoGaDB {
         return ColumnPtr(new DictionaryEncoding<T>(*this));
     }
 
+    template<class T>
+    void DictionaryEncoding<T>::decode(TID begin, size_t count, T* out) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = valuesByCodeNumber[getCodeNumber(encodedValues[begin + i])];
+        }
+    }
+
+    template<class T>
+    typename ColumnBaseTyped<T>::ColumnCursorPtr DictionaryEncoding<T>::createCursor() {
+        return typename ColumnBaseTyped<T>::ColumnCursorPtr(new Cursor(*this));
+    }
+
+    template<class T>
+    void DictionaryEncoding<T>::gather(const PositionList& tids, T* out) {
+        for (size_t i = 0; i < tids.size(); i++) {
+            if (i + GATHER_PREFETCH_DISTANCE < tids.size()) {
+                __builtin_prefetch(&encodedValues[tids[i + GATHER_PREFETCH_DISTANCE]]);
+            }
+            out[i] = valuesByCodeNumber[getCodeNumber(encodedValues[tids[i]])];
+        }
+    }
+
     template<class T>
     bool DictionaryEncoding<T>::update(TID tid, const boost::any & newValue) {
         //check for different type value or out of range tid
@@ -200,7 +273,7 @@ namespace CoGaDB {
         T value = boost::any_cast<T>(newValue);
 
         //insert the newValue along with its dictionaryCode into the dictionary map(if not already there)
-        dictionary.insert(std::make_pair(value, getNewDictionaryCode()));
+        insertIntoDictionary(value);
         //update the tuple dictionaryCode with the dictionaryCode of the newValue
         encodedValues[tid] = dictionary.at(value);
 
@@ -217,7 +290,7 @@ namespace CoGaDB {
         T value = boost::any_cast<T>(newValue);
 
         //insert the newValue along with its dictionaryCode into the dictionary map(if not already there)
-        dictionary.insert(std::make_pair(value, getNewDictionaryCode()));
+        insertIntoDictionary(value);
 
         //loop over the tids and update them one by one
         for (uint64_t i = 0; i < tids->size(); i++) {
@@ -259,9 +332,87 @@ namespace CoGaDB {
     bool DictionaryEncoding<T>::clearContent() {
         dictionary.clear();
         encodedValues.clear();
+        valuesByCodeNumber.clear();
         return true;
     }
 
+    template<class T>
+    uint64_t DictionaryEncoding<T>::getCodeNumber(const std::vector<bool>& dictionaryCode) {
+        uint64_t number = 0;
+        for (uint64_t i = 0; i < dictionaryCode.size(); i++) {
+            number |= uint64_t(dictionaryCode[i]) << i;
+        }
+        return number;
+    }
+
+    template<class T>
+    void DictionaryEncoding<T>::insertIntoDictionary(const T& value) {
+        //the new code numbers count up from zero, so the value of a new code is appended to the table
+        if (dictionary.insert(std::make_pair(value, getNewDictionaryCode())).second) {
+            valuesByCodeNumber.push_back(value);
+        }
+    }
+
+    template<class T>
+    void DictionaryEncoding<T>::rebuildValuesByCodeNumber() {
+        valuesByCodeNumber.resize(dictionary.size());
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = dictionary.begin(); it != dictionary.end(); it++) {
+            valuesByCodeNumber[getCodeNumber(it->second)] = it->first;
+        }
+    }
+
+    template<class T>
+    const PositionListPtr DictionaryEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (T)) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+        typedef typename std::map < T, std::vector<bool> >::const_iterator DictionaryIterator;
+
+        //the dictionary is sorted by value, so all comparators except SUBSTRING match a contiguous range found by binary search
+        DictionaryIterator first = dictionary.begin();
+        DictionaryIterator last = dictionary.end();
+        if (comp == EQUAL) {
+            first = dictionary.lower_bound(value);
+            last = dictionary.upper_bound(value);
+        } else if (comp == LESSER) {
+            last = dictionary.lower_bound(value);
+        } else if (comp == GREATER) {
+            first = dictionary.upper_bound(value);
+        } else if (comp == PREFIX) {
+            //all values starting with the prefix are not lesser than the prefix itself
+            first = dictionary.lower_bound(value);
+            last = first;
+            while (last != dictionary.end() && evaluatePredicate(last->first, value, comp)) {
+                ++last;
+            }
+        }
+
+        //the dictionary codes are numbered in insertion order, so the matching codes are marked in a table
+        std::vector<char> matchingCodes(dictionary.size(), 0);
+        uint64_t numberOfMatchingCodes = 0;
+        for (DictionaryIterator it = first; it != last; ++it) {
+            //substring matching tests every distinct value once
+            if (comp != SUBSTRING || evaluatePredicate(it->first, value, comp)) {
+                matchingCodes[getCodeNumber(it->second)] = 1;
+                numberOfMatchingCodes++;
+            }
+        }
+
+        PositionListPtr result_tids(new PositionList());
+        if (numberOfMatchingCodes == 0) {
+            return result_tids;
+        }
+        result_tids->resize(encodedValues.size());
+        size_t numberOfResults = 0;
+        for (TID i = 0; i < encodedValues.size(); i++) {
+            (*result_tids)[numberOfResults] = i;
+            numberOfResults += matchingCodes[getCodeNumber(encodedValues[i])];
+        }
+        result_tids->resize(numberOfResults);
+        return result_tids;
+    }
+
     template<class T>
     bool DictionaryEncoding<T>::store(const std::string & path_) {
         //string path("data/");
@@ -296,6 +447,7 @@ namespace CoGaDB {
         ia >> dictionary;
         ia >> encodedValues;
         infile.close();
+        rebuildValuesByCodeNumber();
 
 
         return true;
@@ -334,6 +486,152 @@ namespace CoGaDB {
         return size_in_bytes;
     }
 
+    template<class T>
+    DictionaryEncoding<T>::Cursor::Cursor(const DictionaryEncoding<T>& column) : ColumnCursor<T>(column.size()), column(column) {
+    }
+
+    template<class T>
+    void DictionaryEncoding<T>::Cursor::decodeNext(TID begin, size_t count, T* out) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = column.valuesByCodeNumber[getCodeNumber(column.encodedValues[begin + i])];
+        }
+    }
+
+    template<class T>
+    const PositionListPtr DictionaryEncoding<T>::sort(SortOrder order) {
+        if (order != ASCENDING && order != DESCENDING) {
+            return ColumnBaseTyped<T>::sort(order);
+        }
+
+        //the dictionary map is ordered by value, so the rank of a code is the position of its value in the map
+        std::vector<uint64_t> ranks(dictionary.size());
+        uint64_t rank = 0;
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = dictionary.begin(); it != dictionary.end(); it++, rank++) {
+            ranks[getCodeNumber(it->second)] = order == ASCENDING ? rank : dictionary.size() - 1 - rank;
+        }
+
+        //count the values per rank and place the TIDs behind all smaller ranks, TIDs of equal values stay ascending
+        std::vector<uint64_t> rowRanks(encodedValues.size());
+        std::vector<uint64_t> offsets(dictionary.size() + 1, 0);
+        for (TID i = 0; i < encodedValues.size(); i++) {
+            rowRanks[i] = ranks[getCodeNumber(encodedValues[i])];
+            offsets[rowRanks[i] + 1]++;
+        }
+        for (uint64_t i = 1; i < offsets.size(); i++) {
+            offsets[i] += offsets[i - 1];
+        }
+        PositionListPtr ids(new PositionList(encodedValues.size()));
+        for (TID i = 0; i < encodedValues.size(); i++) {
+            (*ids)[offsets[rowRanks[i]]++] = i;
+        }
+        return ids;
+    }
+
+    template<class T>
+    const PositionListPairPtr DictionaryEncoding<T>::hash_join(ColumnPtr join_column) {
+        DictionaryEncoding<T>* join_dictionary = dynamic_cast<DictionaryEncoding<T>*> (join_column.get());
+        if (join_dictionary == NULL) {
+            return ColumnBaseTyped<T>::hash_join(join_column);
+        }
+
+        PositionListPairPtr join_tids(new PositionListPair());
+        join_tids->first = PositionListPtr(new PositionList());
+        join_tids->second = PositionListPtr(new PositionList());
+
+        //vector<[CODE_NUMBER_IN_JOIN_DICTIONARY]>, indexed by the code numbers of this dictionary, JOIN_EMPTY_SLOT for values without partner
+        std::vector<uint64_t> joinCodes(dictionary.size(), JOIN_EMPTY_SLOT);
+        typename std::map < T, std::vector<bool> >::const_iterator it = dictionary.begin();
+        typename std::map < T, std::vector<bool> >::const_iterator joinIt = join_dictionary->dictionary.begin();
+        while (it != dictionary.end() && joinIt != join_dictionary->dictionary.end()) {
+            if (it->first < joinIt->first) {
+                it++;
+            } else if (joinIt->first < it->first) {
+                joinIt++;
+            } else {
+                joinCodes[getCodeNumber(it->second)] = getCodeNumber(joinIt->second);
+                it++;
+                joinIt++;
+            }
+        }
+
+        //the TIDs of join_column are grouped by code, the TIDs of a code stay ascending
+        std::vector<uint64_t> joinCodeBegins(join_dictionary->dictionary.size() + 1, 0);
+        for (TID i = 0; i < join_dictionary->encodedValues.size(); i++) {
+            joinCodeBegins[getCodeNumber(join_dictionary->encodedValues[i]) + 1]++;
+        }
+        for (uint64_t i = 1; i < joinCodeBegins.size(); i++) {
+            joinCodeBegins[i] += joinCodeBegins[i - 1];
+        }
+        PositionList joinPositions(join_dictionary->encodedValues.size());
+        std::vector<uint64_t> offsets(joinCodeBegins.begin(), joinCodeBegins.end() - 1);
+        for (TID i = 0; i < join_dictionary->encodedValues.size(); i++) {
+            joinPositions[offsets[getCodeNumber(join_dictionary->encodedValues[i])]++] = i;
+        }
+
+        for (TID i = 0; i < encodedValues.size(); i++) {
+            uint64_t joinCode = joinCodes[getCodeNumber(encodedValues[i])];
+            if (joinCode != JOIN_EMPTY_SLOT) {
+                join_tids->first->insert(join_tids->first->end(), joinCodeBegins[joinCode + 1] - joinCodeBegins[joinCode], i);
+                join_tids->second->insert(join_tids->second->end(), joinPositions.begin() + joinCodeBegins[joinCode], joinPositions.begin() + joinCodeBegins[joinCode + 1]);
+            }
+        }
+        return join_tids;
+    }
+
+    template<class T>
+    bool DictionaryEncoding<T>::hasCompressedJoin(ColumnBaseTyped<T>& join_column, JoinAlgorithm& algorithm) {
+        if (dynamic_cast<DictionaryEncoding<T>*> (&join_column) == NULL) {
+            return false;
+        }
+        algorithm = HASH_JOIN;
+        return true;
+    }
+
+    template<class T>
+    size_t DictionaryEncoding<T>::getNumberOfDistinctValues() {
+        return dictionary.size();
+    }
+
+    template<class T>
+    const PositionListPtr DictionaryEncoding<T>::filter_selection(const JoinFilter<T>& filter) {
+        //the passing codes are marked in a table indexed by code number, so the scan never decodes a value
+        std::vector<char> matchingCodes(dictionary.size(), 0);
+        uint64_t numberOfMatchingCodes = 0;
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = dictionary.begin(); it != dictionary.end(); it++) {
+            if (filter.mayContain(it->first)) {
+                matchingCodes[getCodeNumber(it->second)] = 1;
+                numberOfMatchingCodes++;
+            }
+        }
+
+        PositionListPtr result_tids(new PositionList());
+        if (numberOfMatchingCodes == 0) {
+            return result_tids;
+        }
+        result_tids->resize(encodedValues.size());
+        size_t numberOfResults = 0;
+        for (TID i = 0; i < encodedValues.size(); i++) {
+            (*result_tids)[numberOfResults] = i;
+            numberOfResults += matchingCodes[getCodeNumber(encodedValues[i])];
+        }
+        result_tids->resize(numberOfResults);
+        return result_tids;
+    }
+
+    template<class T>
+    bool DictionaryEncoding<T>::transformValues(ArithmeticOperation operation, const T& constant) {
+        //the codes of distinct values stay distinct, unless two values are transformed to the same one
+        std::map<T, std::vector<bool> > transformedDictionary;
+        for (typename std::map < T, std::vector<bool> >::const_iterator it = dictionary.begin(); it != dictionary.end(); it++) {
+            if (!transformedDictionary.insert(std::make_pair(applyArithmeticOperation(it->first, constant, operation), it->second)).second) {
+                return false;
+            }
+        }
+        dictionary.swap(transformedDictionary);
+        rebuildValuesByCodeNumber();
+        return true;
+    }
+
     /***************** End of Implementation Section ******************/
 
 
@@ -0,0 +1,578 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <cstring>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a XOR compressed column of floating point values with type T (float or double).
+     *  \details   Every value is XORed with its predecessor. Identical values cost a single bit, otherwise only the meaningful bits
+     *             between the leading and trailing zeros of the XOR result are stored, reusing the zero window of the previous value
+     *             whenever it fits. Values are grouped in blocks of BLOCK_SIZE values which start at a word boundary of the bit stream
+     *             with an uncompressed first value. The word offsets of the blocks form a seek index for random access, and blocks
+     *             can be decoded into buffers independently of each other.
+     */
+    template<class T>
+    class FloatXorEncoding : public CompressedColumn<T> {
+    public:
+        /*! \brief number of values stored in one block*/
+        static const unsigned int BLOCK_SIZE = 128;
+
+        /***************** constructors and destructor *****************/
+        FloatXorEncoding(const std::string& name, AttributeType db_type);
+        virtual ~FloatXorEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief decodes the bit stream of every covered block once, stopping at the end of the range*/
+        virtual void decode(TID begin, size_t count, T* out);
+
+        /*! \brief filters the column by decoding it block wise into a buffer*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+        /*! \brief decodes the first count values of a block into out*/
+        void decodeBlock(uint64_t blockIndex, unsigned int count, T* out) const;
+        /*! \brief returns the number of blocks of the column*/
+        uint64_t getNumberOfBlocks() const throw ();
+
+        virtual T& operator[](const int index);
+
+    private:
+        /*number of bits of a value and of the leading zero and length fields of a header*/
+        static const unsigned int VALUE_BITS = sizeof (T) * 8;
+        static const unsigned int HEADER_FIELD_BITS = (sizeof (T) == 8) ? 6 : 5;
+
+        /*state of the encoder at the end of a bit stream*/
+        struct EncoderState {
+            EncoderState();
+            uint64_t bitPosition;
+            uint64_t previousBits;
+            unsigned int previousLeading;
+            unsigned int previousTrailing;
+
+            template<class Archive>
+            void serialize(Archive& ar, const unsigned int) {
+                ar & bitPosition;
+                ar & previousBits;
+                ar & previousLeading;
+                ar & previousTrailing;
+            }
+        };
+
+        static uint64_t toBits(const T& value);
+        static T fromBits(uint64_t bits);
+        /*appends the lowest bits of value to words, keeping two zero words behind the end of the stream*/
+        static void appendBits(std::vector<uint64_t>& words, EncoderState& state, uint64_t value, unsigned int bits);
+        /*appends a value to words, the first value of a block is stored uncompressed*/
+        static void appendValue(std::vector<uint64_t>& words, EncoderState& state, const T& value, bool firstValueOfBlock);
+        static uint64_t readBits(const std::vector<uint64_t>& words, uint64_t& bitPosition, unsigned int bits);
+
+        /*returns the number of values of a block*/
+        unsigned int getBlockSize(uint64_t blockIndex) const;
+        /*encodes the values of a block again and replaces its words in the bit stream*/
+        void reencodeBlock(uint64_t blockIndex, const T* values);
+        /*removes all blocks starting at blockIndex and returns their values*/
+        void truncate(uint64_t blockIndex, std::vector<T>& values);
+
+        const T getValue(TID tid) const;
+
+        /*compressed values structure*/
+        /*vector<[WORD_OFFSET_OF_BLOCK]>*/
+        std::vector<uint32_t> blockOffsets;
+        /*bit stream of all blocks*/
+        std::vector<uint64_t> encodedValues;
+        /*state of the encoder at the end of the last block*/
+        EncoderState encoderState;
+        uint64_t numberOfValues;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    FloatXorEncoding<T>::EncoderState::EncoderState() : bitPosition(0), previousBits(0), previousLeading(0), previousTrailing(0) {
+
+    }
+
+    template<class T>
+    FloatXorEncoding<T>::FloatXorEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type), blockOffsets(), encodedValues(), encoderState(), numberOfValues(0) {
+
+    }
+
+    template<class T>
+    FloatXorEncoding<T>::~FloatXorEncoding() {
+
+    }
+
+    template<class T>
+    uint64_t FloatXorEncoding<T>::toBits(const T& value) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof (T));
+        return bits;
+    }
+
+    template<class T>
+    T FloatXorEncoding<T>::fromBits(uint64_t bits) {
+        T value;
+        std::memcpy(&value, &bits, sizeof (T));
+        return value;
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::appendBits(std::vector<uint64_t>& words, EncoderState& state, uint64_t value, unsigned int bits) {
+        if (bits == 0) {
+            return;
+        }
+        uint64_t word = state.bitPosition >> 6;
+        unsigned int shift = state.bitPosition & 63;
+        if (words.size() < word + 3) {
+            words.resize(word + 3, 0);
+        }
+        if (bits < 64) {
+            value &= (uint64_t(1) << bits) - 1;
+        }
+        words[word] |= value << shift;
+        //the value overlaps into the next word
+        if (shift + bits > 64) {
+            words[word + 1] |= value >> (64 - shift);
+        }
+        state.bitPosition += bits;
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::appendValue(std::vector<uint64_t>& words, EncoderState& state, const T& value, bool firstValueOfBlock) {
+        uint64_t valueBits = toBits(value);
+        if (firstValueOfBlock) {
+            appendBits(words, state, valueBits, VALUE_BITS);
+            //the first XOR of a block always writes a complete header
+            state.previousLeading = VALUE_BITS;
+            state.previousTrailing = VALUE_BITS;
+            state.previousBits = valueBits;
+            return;
+        }
+
+        uint64_t xorBits = valueBits ^ state.previousBits;
+        state.previousBits = valueBits;
+        if (xorBits == 0) {
+            //control bit 0: value repeats
+            appendBits(words, state, 0, 1);
+            return;
+        }
+
+        unsigned int leading = __builtin_clzll(xorBits) - (64 - VALUE_BITS);
+        unsigned int trailing = __builtin_ctzll(xorBits);
+        if (leading >= state.previousLeading && trailing >= state.previousTrailing) {
+            //control bits 1,0: meaningful bits fit into the window of the previous value
+            appendBits(words, state, 1, 2);
+            appendBits(words, state, xorBits >> state.previousTrailing, VALUE_BITS - state.previousLeading - state.previousTrailing);
+        } else {
+            //control bits 1,1: new window with leading zeros and length of the meaningful bits
+            unsigned int length = VALUE_BITS - leading - trailing;
+            appendBits(words, state, 3, 2);
+            appendBits(words, state, leading, HEADER_FIELD_BITS);
+            appendBits(words, state, length - 1, HEADER_FIELD_BITS);
+            appendBits(words, state, xorBits >> trailing, length);
+            state.previousLeading = leading;
+            state.previousTrailing = trailing;
+        }
+    }
+
+    template<class T>
+    uint64_t FloatXorEncoding<T>::readBits(const std::vector<uint64_t>& words, uint64_t& bitPosition, unsigned int bits) {
+        uint64_t word = bitPosition >> 6;
+        unsigned int shift = bitPosition & 63;
+        //the double shift avoids an undefined shift by 64 in case shift is 0
+        uint64_t value = (words[word] >> shift) | ((words[word + 1] << 1) << (63 - shift));
+        bitPosition += bits;
+        if (bits < 64) {
+            value &= (uint64_t(1) << bits) - 1;
+        }
+        return value;
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::decodeBlock(uint64_t blockIndex, unsigned int count, T* out) const {
+        if (count == 0) {
+            return;
+        }
+        uint64_t bitPosition = uint64_t(blockOffsets[blockIndex]) * 64;
+        uint64_t valueBits = readBits(encodedValues, bitPosition, VALUE_BITS);
+        unsigned int leading = 0;
+        unsigned int length = 0;
+        out[0] = fromBits(valueBits);
+
+        for (unsigned int i = 1; i < count; i++) {
+            uint64_t control = readBits(encodedValues, bitPosition, 1);
+            if (control != 0) {
+                if (readBits(encodedValues, bitPosition, 1) != 0) {
+                    leading = readBits(encodedValues, bitPosition, HEADER_FIELD_BITS);
+                    length = readBits(encodedValues, bitPosition, HEADER_FIELD_BITS) + 1;
+                }
+                uint64_t meaningfulBits = readBits(encodedValues, bitPosition, length);
+                valueBits ^= meaningfulBits << (VALUE_BITS - leading - length);
+            }
+            out[i] = fromBits(valueBits);
+        }
+    }
+
+    template<class T>
+    uint64_t FloatXorEncoding<T>::getNumberOfBlocks() const throw () {
+        return blockOffsets.size();
+    }
+
+    template<class T>
+    unsigned int FloatXorEncoding<T>::getBlockSize(uint64_t blockIndex) const {
+        uint64_t begin = blockIndex * BLOCK_SIZE;
+        return (numberOfValues - begin < BLOCK_SIZE) ? numberOfValues - begin : BLOCK_SIZE;
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::reencodeBlock(uint64_t blockIndex, const T* values) {
+        std::vector<uint64_t> words;
+        EncoderState state;
+        unsigned int blockSize = getBlockSize(blockIndex);
+        for (unsigned int i = 0; i < blockSize; i++) {
+            appendValue(words, state, values[i], i == 0);
+        }
+
+        uint32_t offset = blockOffsets[blockIndex];
+        if (blockIndex + 1 == blockOffsets.size()) {
+            //the last block keeps the trailing zero words and continues the encoder state
+            encodedValues.resize(offset);
+            encodedValues.insert(encodedValues.end(), words.begin(), words.end());
+            state.bitPosition += uint64_t(offset) * 64;
+            encoderState = state;
+            return;
+        }
+
+        //replace the words of the block and move all following blocks accordingly
+        uint32_t newNumberOfWords = (state.bitPosition + 63) / 64;
+        uint32_t oldNumberOfWords = blockOffsets[blockIndex + 1] - offset;
+        if (newNumberOfWords > oldNumberOfWords) {
+            encodedValues.insert(encodedValues.begin() + offset, newNumberOfWords - oldNumberOfWords, 0);
+        } else if (newNumberOfWords < oldNumberOfWords) {
+            encodedValues.erase(encodedValues.begin() + offset, encodedValues.begin() + offset + oldNumberOfWords - newNumberOfWords);
+        }
+        std::copy(words.begin(), words.begin() + newNumberOfWords, encodedValues.begin() + offset);
+        for (uint64_t i = blockIndex + 1; i < blockOffsets.size(); i++) {
+            blockOffsets[i] = blockOffsets[i] + newNumberOfWords - oldNumberOfWords;
+        }
+        encoderState.bitPosition += (int64_t(newNumberOfWords) - int64_t(oldNumberOfWords)) * 64;
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::truncate(uint64_t blockIndex, std::vector<T>& values) {
+        values.resize(numberOfValues - blockIndex * BLOCK_SIZE);
+        for (uint64_t i = blockIndex; i < blockOffsets.size(); i++) {
+            decodeBlock(i, getBlockSize(i), &values[(i - blockIndex) * BLOCK_SIZE]);
+        }
+
+        if (blockIndex < blockOffsets.size()) {
+            //the previous block may read up to two words behind its end
+            encodedValues.resize(blockOffsets[blockIndex]);
+            encodedValues.resize(blockOffsets[blockIndex] + 2, 0);
+            encoderState = EncoderState();
+            encoderState.bitPosition = uint64_t(blockOffsets[blockIndex]) * 64;
+        }
+        blockOffsets.resize(blockIndex);
+        numberOfValues = blockIndex * BLOCK_SIZE;
+    }
+
+    template<class T>
+    const T FloatXorEncoding<T>::getValue(TID tid) const {
+        T values[BLOCK_SIZE];
+        uint64_t blockIndex = tid / BLOCK_SIZE;
+        unsigned int index = tid % BLOCK_SIZE;
+        //decoding stops at the requested value
+        decodeBlock(blockIndex, index + 1, values);
+        return values[index];
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::insert(const T& newValue) {
+        bool firstValueOfBlock = (numberOfValues % BLOCK_SIZE == 0);
+        if (firstValueOfBlock) {
+            //every block starts at a word boundary
+            encoderState.bitPosition = (encoderState.bitPosition + 63) / 64 * 64;
+            blockOffsets.push_back(encoderState.bitPosition / 64);
+        }
+        appendValue(encodedValues, encoderState, newValue, firstValueOfBlock);
+        numberOfValues++;
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool FloatXorEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any FloatXorEncoding<T>::get(TID tid) {
+        if (tid < numberOfValues) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        T values[BLOCK_SIZE];
+        for (uint64_t i = 0; i < blockOffsets.size(); i++) {
+            unsigned int blockSize = getBlockSize(i);
+            decodeBlock(i, blockSize, values);
+            for (unsigned int j = 0; j < blockSize; j++) {
+                std::cout << "| " << values[j] << " |" << std::endl;
+            }
+        }
+    }
+
+    template<class T>
+    size_t FloatXorEncoding<T>::size() const throw () {
+        return numberOfValues;
+    }
+
+    template<class T>
+    const ColumnPtr FloatXorEncoding<T>::copy() const {
+        return ColumnPtr(new FloatXorEncoding<T>(*this));
+    }
+
+    template<class T>
+    void FloatXorEncoding<T>::decode(TID begin, size_t count, T* out) {
+        //a block is decoded from its first value up to the last value needed from it
+        T values[BLOCK_SIZE];
+        TID end = begin + count;
+        TID tid = begin;
+        while (tid < end) {
+            uint64_t blockIndex = tid / BLOCK_SIZE;
+            TID blockBegin = blockIndex * BLOCK_SIZE;
+            TID blockEnd = std::min(end, blockBegin + getBlockSize(blockIndex));
+            if (tid == blockBegin) {
+                decodeBlock(blockIndex, blockEnd - blockBegin, out + (tid - begin));
+            } else {
+                decodeBlock(blockIndex, blockEnd - blockBegin, values);
+                std::copy(values + (tid - blockBegin), values + (blockEnd - blockBegin), out + (tid - begin));
+            }
+            tid = blockEnd;
+        }
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= numberOfValues) {
+            return false;
+        }
+
+        //decode the block, change the value and encode the block again
+        T values[BLOCK_SIZE];
+        uint64_t blockIndex = tid / BLOCK_SIZE;
+        decodeBlock(blockIndex, getBlockSize(blockIndex), values);
+        values[tid % BLOCK_SIZE] = boost::any_cast<T>(newValue);
+        reencodeBlock(blockIndex, values);
+        return true;
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= numberOfValues) {
+            return false;
+        }
+
+        //decode all values from the block of tid on and encode them again without the removed value
+        uint64_t blockIndex = tid / BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+        values.erase(values.begin() + (tid - blockIndex * BLOCK_SIZE));
+        return this->insert(values.begin(), values.end());
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || numberOfValues == 0) {
+            return false;
+        }
+        if (tids->back() >= numberOfValues) {
+            return false;
+        }
+
+        //decode all values from the block of the first tid on and encode them again without the removed values
+        uint64_t blockIndex = tids->front() / BLOCK_SIZE;
+        TID base = blockIndex * BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+
+        std::vector<T> remainingValues;
+        remainingValues.reserve(values.size());
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = 0; i < values.size(); i++) {
+            if (it != tids->end() && *it == base + i) {
+                ++it;
+            } else {
+                remainingValues.push_back(values[i]);
+            }
+        }
+        return this->insert(remainingValues.begin(), remainingValues.end());
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::clearContent() {
+        blockOffsets.clear();
+        encodedValues.clear();
+        encoderState = EncoderState();
+        numberOfValues = 0;
+        return true;
+    }
+
+    template<class T>
+    const PositionListPtr FloatXorEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        //prefix and substring predicates only apply to strings, the generic selection rejects them
+        if (value_for_comparison.type() != typeid (T) || comp == PREFIX || comp == SUBSTRING) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+        T values[BLOCK_SIZE];
+        for (uint64_t blockIndex = 0; blockIndex < blockOffsets.size(); blockIndex++) {
+            TID base = blockIndex * BLOCK_SIZE;
+            unsigned int blockSize = getBlockSize(blockIndex);
+            decodeBlock(blockIndex, blockSize, values);
+
+            size_t numberOfResults = result_tids->size();
+            result_tids->resize(numberOfResults + blockSize);
+            TID* out = &(*result_tids)[numberOfResults];
+            unsigned int numberOfMatches = 0;
+            //predicated store, every tid is written and only matches advance the output position
+            for (unsigned int i = 0; i < blockSize; i++) {
+                out[numberOfMatches] = base + i;
+                numberOfMatches += evaluatePredicate(values[i], value, comp);
+            }
+            result_tids->resize(numberOfResults + numberOfMatches);
+        }
+        return result_tids;
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << blockOffsets;
+        oa << encodedValues;
+        oa << encoderState;
+        oa << numberOfValues;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool FloatXorEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> blockOffsets;
+        ia >> encodedValues;
+        ia >> encoderState;
+        ia >> numberOfValues;
+
+        infile.close();
+        return true;
+    }
+
+    template<class T>
+    T& FloatXorEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((uint64_t) tid < numberOfValues) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int FloatXorEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = blockOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += encodedValues.capacity() * sizeof (uint64_t);
+        size_in_bytes += sizeof (encoderState) + sizeof (numberOfValues);
+        return size_in_bytes;
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
@@ -0,0 +1,499 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <compression/BitPacking.hpp>
+#include <functional>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a frame of reference compressed column with type T.
+     *  \details   Values are grouped in blocks of BitPacking::BLOCK_SIZE values. Each block stores its minimum and the bit packed
+     *             differences of its values to that minimum, using the smallest bit width that fits the largest difference.
+     *             Values that do not fill a complete block yet are kept uncompressed until the block is full.
+     *             T has to be an integral type of at most 32 bits.
+     */
+    template<class T>
+    class FrameOfReferenceEncoding : public CompressedColumn<T> {
+    public:
+        /***************** constructors and destructor *****************/
+        FrameOfReferenceEncoding(const std::string& name, AttributeType db_type);
+        virtual ~FrameOfReferenceEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief unpacks the blocks covering the range, complete blocks are unpacked in place*/
+        virtual void decode(TID begin, size_t count, T* out);
+
+        /*! \brief filters the column on the packed differences, blocks whose value range excludes or covers the predicate are not unpacked at all*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+
+
+        virtual T& operator[](const int index);
+
+    private:
+
+        /*appends a complete block of values to the packed values*/
+        void packBlock(const T* values);
+        /*replaces the packed values of an existing block, which may change its bit width*/
+        void repackBlock(uint64_t blockIndex, const T* values);
+        /*decodes a complete block into values*/
+        void unpackBlock(uint64_t blockIndex, T* values) const;
+        /*removes all blocks starting at blockIndex and returns their values followed by the uncompressed tail*/
+        void truncate(uint64_t blockIndex, std::vector<T>& values);
+        /*computes the minimum and the packed differences of a block*/
+        unsigned int computeDifferences(const T* values, T& minimum, uint32_t* differences) const;
+
+        const T getValue(TID tid) const;
+
+        /*writes the TIDs of all differences of a block matching the comparator to out and returns the number of matches*/
+        template<class Comparator>
+        unsigned int selectBlock(const uint32_t* differences, uint32_t reference, TID base, TID* out) const;
+
+        /*compressed values structure*/
+        /*vector<[BLOCK_MINIMUM]>*/
+        std::vector<T> blockMinimums;
+        /*vector<[BLOCK_BIT_WIDTH]>*/
+        std::vector<unsigned char> blockBitWidths;
+        /*vector<[WORD_OFFSET_OF_BLOCK]>*/
+        std::vector<uint32_t> blockOffsets;
+        /*bit packed differences of all blocks, followed by a zero guard word*/
+        std::vector<uint64_t> packedValues;
+        /*values of the last, incomplete block*/
+        std::vector<T> uncompressedTail;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    FrameOfReferenceEncoding<T>::FrameOfReferenceEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type) {
+
+    }
+
+    template<class T>
+    FrameOfReferenceEncoding<T>::~FrameOfReferenceEncoding() {
+
+    }
+
+    template<class T>
+    unsigned int FrameOfReferenceEncoding<T>::computeDifferences(const T* values, T& minimum, uint32_t* differences) const {
+        minimum = values[0];
+        for (unsigned int i = 1; i < BitPacking::BLOCK_SIZE; i++) {
+            if (values[i] < minimum) {
+                minimum = values[i];
+            }
+        }
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            differences[i] = (uint32_t) values[i] - (uint32_t) minimum;
+        }
+        return BitPacking::getMaxBits(differences, BitPacking::BLOCK_SIZE);
+    }
+
+    template<class T>
+    void FrameOfReferenceEncoding<T>::packBlock(const T* values) {
+        T minimum;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        unsigned int bits = computeDifferences(values, minimum, differences);
+
+        //the new block starts at the position of the current guard word
+        uint32_t offset = packedValues.empty() ? 0 : packedValues.size() - 1;
+        packedValues.resize(offset + bits + 1, 0);
+        BitPacking::packBlock(differences, bits, &packedValues[offset]);
+        packedValues.back() = 0;
+
+        blockMinimums.push_back(minimum);
+        blockBitWidths.push_back(bits);
+        blockOffsets.push_back(offset);
+    }
+
+    template<class T>
+    void FrameOfReferenceEncoding<T>::repackBlock(uint64_t blockIndex, const T* values) {
+        T minimum;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        unsigned int bits = computeDifferences(values, minimum, differences);
+        unsigned int oldBits = blockBitWidths[blockIndex];
+        uint32_t offset = blockOffsets[blockIndex];
+
+        //resize the word range of the block and move all following blocks accordingly
+        if (bits > oldBits) {
+            packedValues.insert(packedValues.begin() + offset + oldBits, bits - oldBits, 0);
+        } else if (bits < oldBits) {
+            packedValues.erase(packedValues.begin() + offset + bits, packedValues.begin() + offset + oldBits);
+        }
+        for (uint64_t i = blockIndex + 1; i < blockOffsets.size(); i++) {
+            blockOffsets[i] = blockOffsets[i] + bits - oldBits;
+        }
+
+        BitPacking::packBlock(differences, bits, &packedValues[offset]);
+        blockMinimums[blockIndex] = minimum;
+        blockBitWidths[blockIndex] = bits;
+    }
+
+    template<class T>
+    void FrameOfReferenceEncoding<T>::unpackBlock(uint64_t blockIndex, T* values) const {
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+        uint32_t minimum = (uint32_t) blockMinimums[blockIndex];
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            values[i] = (T) (differences[i] + minimum);
+        }
+    }
+
+    template<class T>
+    void FrameOfReferenceEncoding<T>::truncate(uint64_t blockIndex, std::vector<T>& values) {
+        uint64_t numberOfBlocks = blockMinimums.size();
+        values.resize((numberOfBlocks - blockIndex) * BitPacking::BLOCK_SIZE);
+        for (uint64_t i = blockIndex; i < numberOfBlocks; i++) {
+            unpackBlock(i, &values[(i - blockIndex) * BitPacking::BLOCK_SIZE]);
+        }
+        values.insert(values.end(), uncompressedTail.begin(), uncompressedTail.end());
+
+        if (blockIndex < numberOfBlocks) {
+            packedValues.resize(blockOffsets[blockIndex] + 1);
+            packedValues.back() = 0;
+        }
+        if (blockIndex == 0) {
+            packedValues.clear();
+        }
+        blockMinimums.resize(blockIndex);
+        blockBitWidths.resize(blockIndex);
+        blockOffsets.resize(blockIndex);
+        uncompressedTail.clear();
+    }
+
+    template<class T>
+    const T FrameOfReferenceEncoding<T>::getValue(TID tid) const {
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex < blockMinimums.size()) {
+            uint32_t difference = BitPacking::extract(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], tid % BitPacking::BLOCK_SIZE);
+            return (T) (difference + (uint32_t) blockMinimums[blockIndex]);
+        }
+        return uncompressedTail[tid - blockMinimums.size() * BitPacking::BLOCK_SIZE];
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::insert(const T& newValue) {
+        uncompressedTail.push_back(newValue);
+        //compress the tail as soon as it fills a complete block
+        if (uncompressedTail.size() == BitPacking::BLOCK_SIZE) {
+            packBlock(&uncompressedTail[0]);
+            uncompressedTail.clear();
+        }
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool FrameOfReferenceEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any FrameOfReferenceEncoding<T>::get(TID tid) {
+        if (tid < this->size()) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void FrameOfReferenceEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        for (TID i = 0; i < this->size(); i++) {
+            std::cout << "| " << getValue(i) << " |" << std::endl;
+        }
+    }
+
+    template<class T>
+    size_t FrameOfReferenceEncoding<T>::size() const throw () {
+        return blockMinimums.size() * BitPacking::BLOCK_SIZE + uncompressedTail.size();
+    }
+
+    template<class T>
+    const ColumnPtr FrameOfReferenceEncoding<T>::copy() const {
+        return ColumnPtr(new FrameOfReferenceEncoding<T>(*this));
+    }
+
+    template<class T>
+    void FrameOfReferenceEncoding<T>::decode(TID begin, size_t count, T* out) {
+        BitPacking::decodeBlocks(*this, &FrameOfReferenceEncoding<T>::unpackBlock, blockMinimums.size(), uncompressedTail, begin, count, out);
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= this->size()) {
+            return false;
+        }
+        T value = boost::any_cast<T>(newValue);
+
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex == blockMinimums.size()) {
+            uncompressedTail[tid % BitPacking::BLOCK_SIZE] = value;
+            return true;
+        }
+
+        //decode the block, change the value and pack the block again
+        T values[BitPacking::BLOCK_SIZE];
+        unpackBlock(blockIndex, values);
+        values[tid % BitPacking::BLOCK_SIZE] = value;
+        repackBlock(blockIndex, values);
+        return true;
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of tid on and compress them again without the removed value
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+        values.erase(values.begin() + (tid - blockIndex * BitPacking::BLOCK_SIZE));
+        return this->insert(values.begin(), values.end());
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || this->size() == 0) {
+            return false;
+        }
+        if (tids->back() >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of the first tid on and compress them again without the removed values
+        uint64_t blockIndex = tids->front() / BitPacking::BLOCK_SIZE;
+        TID base = blockIndex * BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+
+        std::vector<T> remainingValues;
+        remainingValues.reserve(values.size());
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = 0; i < values.size(); i++) {
+            if (it != tids->end() && *it == base + i) {
+                ++it;
+            } else {
+                remainingValues.push_back(values[i]);
+            }
+        }
+        return this->insert(remainingValues.begin(), remainingValues.end());
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::clearContent() {
+        blockMinimums.clear();
+        blockBitWidths.clear();
+        blockOffsets.clear();
+        packedValues.clear();
+        uncompressedTail.clear();
+        return true;
+    }
+
+    template<class T>
+    template<class Comparator>
+    unsigned int FrameOfReferenceEncoding<T>::selectBlock(const uint32_t* differences, uint32_t reference, TID base, TID* out) const {
+        Comparator comparator;
+        unsigned int numberOfMatches = 0;
+        //predicated store, every tid is written and only matches advance the output position
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            out[numberOfMatches] = base + i;
+            numberOfMatches += comparator(differences[i], reference);
+        }
+        return numberOfMatches;
+    }
+
+    template<class T>
+    const PositionListPtr FrameOfReferenceEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        //prefix and substring predicates only apply to strings, the generic selection rejects them
+        if (value_for_comparison.type() != typeid (T) || comp == PREFIX || comp == SUBSTRING) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+
+        for (uint64_t blockIndex = 0; blockIndex < blockMinimums.size(); blockIndex++) {
+            TID base = blockIndex * BitPacking::BLOCK_SIZE;
+            //translate the comparison value into the difference domain of the block
+            int64_t reference = int64_t(value) - int64_t(blockMinimums[blockIndex]);
+            int64_t maxDifference = BitPacking::getMaxValue(blockBitWidths[blockIndex]);
+
+            bool noMatch = true;
+            bool allMatch = false;
+            if (comp == EQUAL) {
+                noMatch = reference < 0 || reference > maxDifference;
+            } else if (comp == LESSER) {
+                noMatch = reference <= 0;
+                allMatch = reference > maxDifference;
+            } else if (comp == GREATER) {
+                noMatch = reference >= maxDifference;
+                allMatch = reference < 0;
+            }
+
+            if (allMatch) {
+                for (TID i = base; i < base + BitPacking::BLOCK_SIZE; i++) {
+                    result_tids->push_back(i);
+                }
+                continue;
+            }
+            if (noMatch) {
+                continue;
+            }
+
+            BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+            size_t numberOfResults = result_tids->size();
+            result_tids->resize(numberOfResults + BitPacking::BLOCK_SIZE);
+            TID* out = &(*result_tids)[numberOfResults];
+            if (comp == EQUAL) {
+                numberOfResults += selectBlock<std::equal_to<uint32_t> >(differences, reference, base, out);
+            } else if (comp == LESSER) {
+                numberOfResults += selectBlock<std::less<uint32_t> >(differences, reference, base, out);
+            } else {
+                numberOfResults += selectBlock<std::greater<uint32_t> >(differences, reference, base, out);
+            }
+            result_tids->resize(numberOfResults);
+        }
+
+        //the values of the incomplete block are compared directly
+        TID base = blockMinimums.size() * BitPacking::BLOCK_SIZE;
+        for (TID i = 0; i < uncompressedTail.size(); i++) {
+            if (evaluatePredicate(uncompressedTail[i], value, comp)) {
+                result_tids->push_back(base + i);
+            }
+        }
+
+        return result_tids;
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << blockMinimums;
+        oa << blockBitWidths;
+        oa << blockOffsets;
+        oa << packedValues;
+        oa << uncompressedTail;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool FrameOfReferenceEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> blockMinimums;
+        ia >> blockBitWidths;
+        ia >> blockOffsets;
+        ia >> packedValues;
+        ia >> uncompressedTail;
+
+        infile.close();
+        return true;
+    }
+
+    template<class T>
+    T& FrameOfReferenceEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((size_t) tid < this->size()) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int FrameOfReferenceEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = blockMinimums.capacity() * sizeof (T);
+        size_in_bytes += blockBitWidths.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += packedValues.capacity() * sizeof (uint64_t);
+        size_in_bytes += uncompressedTail.capacity() * sizeof (T);
+        return size_in_bytes;
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
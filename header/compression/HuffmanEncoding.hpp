@@ -0,0 +1,814 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <queue>
+#include <map>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a dictionary compressed column with type T, whose codes are Huffman codes.
+     *  \details   Every distinct value is a symbol of the dictionary, and frequent symbols get shorter codes than rare ones. The
+     *             code table is canonical, so it is fully described by the code length of every symbol. Codes are decoded through
+     *             a lookup table indexed by the next LOOKUP_BITS bits of the stream, which yields several short codes at once.
+     *             The bit stream is split into blocks of BLOCK_SIZE values starting at word boundaries. Their word offsets form a
+     *             sync index, so random access and scans can start at any block.
+     *             New values are collected uncompressed until a block is complete. The code table is rebuilt from the actual
+     *             frequencies whenever the column doubled in size since the last build, or earlier if values without a code
+     *             make up an eighth of the column.
+     */
+    template<class T>
+    class HuffmanEncoding : public CompressedColumn<T> {
+    public:
+        /*! \brief number of values between two entries of the sync index*/
+        static const unsigned int BLOCK_SIZE = 128;
+
+        /***************** constructors and destructor *****************/
+        HuffmanEncoding(const std::string& name, AttributeType db_type);
+        virtual ~HuffmanEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief decodes every covered block once from its sync point, stopping at the end of the range*/
+        virtual void decode(TID begin, size_t count, T* out);
+
+        /*! \brief evaluates the predicate once per distinct value and filters the column by decoding it block wise*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+        /*! \brief decodes the first count values of a block into out*/
+        void decodeBlock(uint64_t blockIndex, unsigned int count, T* out) const;
+        /*! \brief returns the number of encoded blocks of the column*/
+        uint64_t getNumberOfBlocks() const throw ();
+
+        virtual T& operator[](const int index);
+
+    private:
+        /*maximal length of a code and number of bits used to index the lookup table*/
+        static const unsigned int MAX_CODE_LENGTH = 32;
+        static const unsigned int LOOKUP_BITS = 8;
+        static const unsigned int MAX_SYMBOLS_PER_LOOKUP = 4;
+
+        /*symbols whose codes fit completely into the LOOKUP_BITS bits of a table index*/
+        struct LookupEntry {
+            uint32_t symbols[MAX_SYMBOLS_PER_LOOKUP];
+            /*number of bits consumed after decoding the first i+1 symbols*/
+            unsigned char bitsConsumed[MAX_SYMBOLS_PER_LOOKUP];
+            unsigned char numberOfSymbols;
+        };
+
+        /*returns the symbol of value and adds value to the dictionary if it is not there yet*/
+        uint32_t getSymbol(const T& value);
+        /*computes the Huffman code length of every symbol*/
+        void buildCodeLengths(const std::vector<uint64_t>& frequencies);
+        /*derives the canonical codes and the decoding tables from the code lengths*/
+        void buildCodeTables();
+        /*drops unused symbols, builds a new code table for symbols and encodes them, the column has to be empty*/
+        void rebuild(std::vector<uint32_t>& symbols);
+
+        /*appends a symbol to the uncompressed tail and encodes the tail as soon as it completes a block*/
+        void insertSymbol(uint32_t symbol);
+        /*encodes the complete blocks of the uncompressed tail, which may rebuild the code table and renumber all symbols*/
+        void flushTail();
+
+        /*encodes BLOCK_SIZE symbols into words*/
+        void encodeBlock(const uint32_t* symbols, std::vector<uint64_t>& words) const;
+        void appendBlock(const uint32_t* symbols);
+        /*encodes the symbols of a block again and replaces its words in the bit stream*/
+        void reencodeBlock(uint64_t blockIndex, const uint32_t* symbols);
+        /*decodes the first count symbols of a block*/
+        void decodeSymbols(uint64_t blockIndex, unsigned int count, uint32_t* symbols) const;
+        /*removes all blocks starting at blockIndex and returns their symbols followed by the uncompressed tail*/
+        void truncate(uint64_t blockIndex, std::vector<uint32_t>& symbols);
+        /*returns the next 64 bits of the stream, starting with the most significant bit*/
+        uint64_t peekBits(uint64_t bitPosition) const;
+
+        const T& getValue(TID tid) const;
+
+        /*compressed values structure*/
+        /*map<[VALUE],[SYMBOL]>*/
+        std::map<T, uint32_t> dictionary;
+        /*vector<[VALUE]>, indexed by symbol*/
+        std::vector<T> dictionaryValues;
+        /*vector<[CODE_LENGTH]>, indexed by symbol, 0 for symbols without code*/
+        std::vector<unsigned char> codeLengths;
+        /*vector<[WORD_OFFSET_OF_BLOCK]>*/
+        std::vector<uint32_t> blockOffsets;
+        /*bit stream of all blocks, followed by a zero guard word*/
+        std::vector<uint64_t> encodedValues;
+        /*symbols of the values that are not encoded yet*/
+        std::vector<uint32_t> uncompressedTail;
+        uint64_t numberOfValuesAtLastBuild;
+
+        /*decoding structures derived from the code lengths*/
+        std::vector<uint32_t> codes;
+        /*first code, index of the first symbol in sortedSymbols and number of codes per code length*/
+        std::vector<uint32_t> firstCodes;
+        std::vector<uint32_t> firstIndices;
+        std::vector<uint32_t> numberOfCodes;
+        /*symbols ordered by code*/
+        std::vector<uint32_t> sortedSymbols;
+        std::vector<LookupEntry> lookupTable;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    HuffmanEncoding<T>::HuffmanEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type), numberOfValuesAtLastBuild(0) {
+
+    }
+
+    template<class T>
+    HuffmanEncoding<T>::~HuffmanEncoding() {
+
+    }
+
+    template<class T>
+    uint32_t HuffmanEncoding<T>::getSymbol(const T& value) {
+        std::pair<typename std::map<T, uint32_t>::iterator, bool> entry = dictionary.insert(std::make_pair(value, (uint32_t) dictionaryValues.size()));
+        if (entry.second) {
+            dictionaryValues.push_back(value);
+            codeLengths.push_back(0);
+        }
+        return entry.first->second;
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::buildCodeLengths(const std::vector<uint64_t>& frequencies) {
+        uint64_t numberOfSymbols = frequencies.size();
+        codeLengths.assign(numberOfSymbols, 0);
+        if (numberOfSymbols == 1) {
+            codeLengths[0] = 1;
+        }
+        if (numberOfSymbols <= 1) {
+            return;
+        }
+
+        std::vector<uint64_t> weights(frequencies);
+        while (true) {
+            //merge the two lightest nodes until only the root is left, nodes behind the symbols are inner nodes
+            std::priority_queue<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint32_t> >, std::greater<std::pair<uint64_t, uint32_t> > > queue;
+            std::vector<uint32_t> parents(numberOfSymbols, 0);
+            for (uint32_t symbol = 0; symbol < numberOfSymbols; symbol++) {
+                queue.push(std::make_pair(weights[symbol], symbol));
+            }
+            while (queue.size() > 1) {
+                std::pair<uint64_t, uint32_t> first = queue.top();
+                queue.pop();
+                std::pair<uint64_t, uint32_t> second = queue.top();
+                queue.pop();
+                uint32_t node = parents.size();
+                parents.push_back(0);
+                parents[first.second] = node;
+                parents[second.second] = node;
+                queue.push(std::make_pair(first.first + second.first, node));
+            }
+
+            //parents are always created after their children, so the depths are computed from the root downwards
+            std::vector<unsigned int> depths(parents.size(), 0);
+            unsigned int maxDepth = 0;
+            for (int64_t node = parents.size() - 2; node >= 0; node--) {
+                depths[node] = depths[parents[node]] + 1;
+                maxDepth = std::max(maxDepth, depths[node]);
+            }
+            if (maxDepth <= MAX_CODE_LENGTH) {
+                for (uint32_t symbol = 0; symbol < numberOfSymbols; symbol++) {
+                    codeLengths[symbol] = depths[symbol];
+                }
+                return;
+            }
+            //flatten the distribution until the longest code fits
+            for (uint32_t symbol = 0; symbol < numberOfSymbols; symbol++) {
+                weights[symbol] = (weights[symbol] + 1) / 2;
+            }
+        }
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::buildCodeTables() {
+        //canonical codes are assigned in order of code length and symbol
+        std::vector<std::pair<unsigned int, uint32_t> > order;
+        for (uint32_t symbol = 0; symbol < codeLengths.size(); symbol++) {
+            if (codeLengths[symbol] != 0) {
+                order.push_back(std::make_pair(codeLengths[symbol], symbol));
+            }
+        }
+        std::sort(order.begin(), order.end());
+
+        codes.assign(codeLengths.size(), 0);
+        firstCodes.assign(MAX_CODE_LENGTH + 1, 0);
+        firstIndices.assign(MAX_CODE_LENGTH + 1, 0);
+        numberOfCodes.assign(MAX_CODE_LENGTH + 1, 0);
+        sortedSymbols.resize(order.size());
+        uint64_t code = 0;
+        unsigned int previousLength = 0;
+        for (uint64_t i = 0; i < order.size(); i++) {
+            unsigned int length = order[i].first;
+            uint32_t symbol = order[i].second;
+            code <<= length - previousLength;
+            if (length != previousLength) {
+                firstCodes[length] = code;
+                firstIndices[length] = i;
+            }
+            codes[symbol] = code;
+            numberOfCodes[length]++;
+            sortedSymbols[i] = symbol;
+            code++;
+            previousLength = length;
+        }
+
+        //every table index holds the symbols of all codes that fit completely into its bits
+        lookupTable.resize(1 << LOOKUP_BITS);
+        for (uint32_t index = 0; index < lookupTable.size(); index++) {
+            LookupEntry& entry = lookupTable[index];
+            entry.numberOfSymbols = 0;
+            unsigned int position = 0;
+            while (entry.numberOfSymbols < MAX_SYMBOLS_PER_LOOKUP) {
+                bool found = false;
+                for (unsigned int length = 1; length + position <= LOOKUP_BITS; length++) {
+                    uint32_t prefix = (index >> (LOOKUP_BITS - position - length)) & ((1 << length) - 1);
+                    if (prefix - firstCodes[length] < numberOfCodes[length]) {
+                        position += length;
+                        entry.symbols[entry.numberOfSymbols] = sortedSymbols[firstIndices[length] + prefix - firstCodes[length]];
+                        entry.bitsConsumed[entry.numberOfSymbols] = position;
+                        entry.numberOfSymbols++;
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    break;
+                }
+            }
+        }
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::rebuild(std::vector<uint32_t>& symbols) {
+        numberOfValuesAtLastBuild = symbols.size();
+
+        //count the symbols and drop the ones that are not used anymore
+        std::vector<uint64_t> counts(dictionaryValues.size(), 0);
+        for (uint64_t i = 0; i < symbols.size(); i++) {
+            counts[symbols[i]]++;
+        }
+        std::vector<uint32_t> newSymbols(dictionaryValues.size(), 0);
+        std::vector<T> newDictionaryValues;
+        std::vector<uint64_t> frequencies;
+        for (uint32_t symbol = 0; symbol < dictionaryValues.size(); symbol++) {
+            if (counts[symbol] != 0) {
+                newSymbols[symbol] = newDictionaryValues.size();
+                newDictionaryValues.push_back(dictionaryValues[symbol]);
+                frequencies.push_back(counts[symbol]);
+            }
+        }
+        dictionaryValues.swap(newDictionaryValues);
+        dictionary.clear();
+        for (uint32_t symbol = 0; symbol < dictionaryValues.size(); symbol++) {
+            dictionary.insert(std::make_pair(dictionaryValues[symbol], symbol));
+        }
+        for (uint64_t i = 0; i < symbols.size(); i++) {
+            symbols[i] = newSymbols[symbols[i]];
+        }
+
+        buildCodeLengths(frequencies);
+        buildCodeTables();
+
+        uint64_t numberOfCompleteBlocks = symbols.size() / BLOCK_SIZE;
+        for (uint64_t i = 0; i < numberOfCompleteBlocks; i++) {
+            appendBlock(&symbols[i * BLOCK_SIZE]);
+        }
+        std::vector<uint32_t>(symbols.begin() + numberOfCompleteBlocks * BLOCK_SIZE, symbols.end()).swap(uncompressedTail);
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::insertSymbol(uint32_t symbol) {
+        uncompressedTail.push_back(symbol);
+        if (uncompressedTail.size() % BLOCK_SIZE == 0) {
+            flushTail();
+        }
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::flushTail() {
+        if (uncompressedTail.size() < BLOCK_SIZE) {
+            return;
+        }
+        if (this->size() >= 2 * numberOfValuesAtLastBuild) {
+            std::vector<uint32_t> symbols;
+            truncate(0, symbols);
+            rebuild(symbols);
+            return;
+        }
+
+        //encode all complete blocks until the first one with a symbol without code
+        uint64_t numberOfEncodedSymbols = 0;
+        while (uncompressedTail.size() - numberOfEncodedSymbols >= BLOCK_SIZE) {
+            bool encodable = true;
+            for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+                encodable = encodable && codeLengths[uncompressedTail[numberOfEncodedSymbols + i]] != 0;
+            }
+            if (!encodable) {
+                break;
+            }
+            appendBlock(&uncompressedTail[numberOfEncodedSymbols]);
+            numberOfEncodedSymbols += BLOCK_SIZE;
+        }
+        uncompressedTail.erase(uncompressedTail.begin(), uncompressedTail.begin() + numberOfEncodedSymbols);
+        if (uncompressedTail.capacity() > 2 * BLOCK_SIZE) {
+            std::vector<uint32_t>(uncompressedTail).swap(uncompressedTail);
+        }
+
+        //values without code are kept uncompressed until they make up an eighth of the column
+        if (uncompressedTail.size() >= BLOCK_SIZE && uncompressedTail.size() * 8 >= this->size()) {
+            std::vector<uint32_t> symbols;
+            truncate(0, symbols);
+            rebuild(symbols);
+        }
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::encodeBlock(const uint32_t* symbols, std::vector<uint64_t>& words) const {
+        words.clear();
+        uint64_t bitPosition = 0;
+        for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+            unsigned int length = codeLengths[symbols[i]];
+            uint64_t word = bitPosition >> 6;
+            unsigned int shift = bitPosition & 63;
+            if (word + 1 >= words.size()) {
+                words.resize(word + 2, 0);
+            }
+            //codes are written most significant bit first
+            uint64_t code = uint64_t(codes[symbols[i]]) << (64 - length);
+            words[word] |= code >> shift;
+            if (shift + length > 64) {
+                words[word + 1] |= code << (64 - shift);
+            }
+            bitPosition += length;
+        }
+        words.resize((bitPosition + 63) / 64);
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::appendBlock(const uint32_t* symbols) {
+        std::vector<uint64_t> words;
+        encodeBlock(symbols, words);
+
+        //the new block starts at the position of the current guard word
+        uint32_t offset = encodedValues.empty() ? 0 : encodedValues.size() - 1;
+        encodedValues.resize(offset);
+        encodedValues.insert(encodedValues.end(), words.begin(), words.end());
+        encodedValues.push_back(0);
+        blockOffsets.push_back(offset);
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::reencodeBlock(uint64_t blockIndex, const uint32_t* symbols) {
+        std::vector<uint64_t> words;
+        encodeBlock(symbols, words);
+
+        //replace the words of the block and move all following blocks accordingly
+        uint32_t begin = blockOffsets[blockIndex];
+        uint32_t end = (blockIndex + 1 < blockOffsets.size()) ? blockOffsets[blockIndex + 1] : encodedValues.size() - 1;
+        encodedValues.erase(encodedValues.begin() + begin, encodedValues.begin() + end);
+        encodedValues.insert(encodedValues.begin() + begin, words.begin(), words.end());
+        for (uint64_t i = blockIndex + 1; i < blockOffsets.size(); i++) {
+            blockOffsets[i] = blockOffsets[i] + words.size() - (end - begin);
+        }
+    }
+
+    template<class T>
+    uint64_t HuffmanEncoding<T>::peekBits(uint64_t bitPosition) const {
+        uint64_t word = bitPosition >> 6;
+        unsigned int shift = bitPosition & 63;
+        //the double shift avoids an undefined shift by 64 in case shift is 0
+        return (encodedValues[word] << shift) | ((encodedValues[word + 1] >> 1) >> (63 - shift));
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::decodeSymbols(uint64_t blockIndex, unsigned int count, uint32_t* symbols) const {
+        uint64_t bitPosition = uint64_t(blockOffsets[blockIndex]) * 64;
+        unsigned int i = 0;
+        while (i < count) {
+            uint64_t bits = peekBits(bitPosition);
+            const LookupEntry& entry = lookupTable[bits >> (64 - LOOKUP_BITS)];
+            if (entry.numberOfSymbols != 0) {
+                //take all symbols of the table entry, but not more than requested
+                unsigned int numberOfSymbols = std::min((unsigned int) entry.numberOfSymbols, count - i);
+                for (unsigned int j = 0; j < numberOfSymbols; j++) {
+                    symbols[i + j] = entry.symbols[j];
+                }
+                bitPosition += entry.bitsConsumed[numberOfSymbols - 1];
+                i += numberOfSymbols;
+                continue;
+            }
+            //codes longer than the table index are decoded canonically
+            unsigned int length = LOOKUP_BITS + 1;
+            for (; length <= MAX_CODE_LENGTH; length++) {
+                uint32_t code = bits >> (64 - length);
+                if (code - firstCodes[length] < numberOfCodes[length]) {
+                    symbols[i++] = sortedSymbols[firstIndices[length] + code - firstCodes[length]];
+                    bitPosition += length;
+                    break;
+                }
+            }
+            //the bits are no code of the column, so the block is corrupt and the bit position would never advance
+            if (length > MAX_CODE_LENGTH) {
+                assert(!"HuffmanEncoding: invalid code in encoded block");
+                std::fill(symbols + i, symbols + count, 0);
+                return;
+            }
+        }
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::decodeBlock(uint64_t blockIndex, unsigned int count, T* out) const {
+        uint32_t symbols[BLOCK_SIZE];
+        decodeSymbols(blockIndex, count, symbols);
+        for (unsigned int i = 0; i < count; i++) {
+            out[i] = dictionaryValues[symbols[i]];
+        }
+    }
+
+    template<class T>
+    uint64_t HuffmanEncoding<T>::getNumberOfBlocks() const throw () {
+        return blockOffsets.size();
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::truncate(uint64_t blockIndex, std::vector<uint32_t>& symbols) {
+        uint64_t numberOfBlocks = blockOffsets.size();
+        symbols.resize((numberOfBlocks - blockIndex) * BLOCK_SIZE);
+        for (uint64_t i = blockIndex; i < numberOfBlocks; i++) {
+            decodeSymbols(i, BLOCK_SIZE, &symbols[(i - blockIndex) * BLOCK_SIZE]);
+        }
+        symbols.insert(symbols.end(), uncompressedTail.begin(), uncompressedTail.end());
+
+        if (blockIndex < numberOfBlocks) {
+            encodedValues.resize(blockOffsets[blockIndex]);
+            encodedValues.push_back(0);
+        }
+        if (blockIndex == 0) {
+            encodedValues.clear();
+        }
+        blockOffsets.resize(blockIndex);
+        uncompressedTail.clear();
+    }
+
+    template<class T>
+    const T& HuffmanEncoding<T>::getValue(TID tid) const {
+        uint64_t blockIndex = tid / BLOCK_SIZE;
+        if (blockIndex >= blockOffsets.size()) {
+            return dictionaryValues[uncompressedTail[tid - blockOffsets.size() * BLOCK_SIZE]];
+        }
+        //decode from the sync point of the block up to tid
+        uint32_t symbols[BLOCK_SIZE];
+        unsigned int position = tid % BLOCK_SIZE;
+        decodeSymbols(blockIndex, position + 1, symbols);
+        return dictionaryValues[symbols[position]];
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::insert(const T& newValue) {
+        insertSymbol(getSymbol(newValue));
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool HuffmanEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any HuffmanEncoding<T>::get(TID tid) {
+        if (tid < this->size()) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        T values[BLOCK_SIZE];
+        for (uint64_t blockIndex = 0; blockIndex < blockOffsets.size(); blockIndex++) {
+            decodeBlock(blockIndex, BLOCK_SIZE, values);
+            for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+                std::cout << "| " << values[i] << " |" << std::endl;
+            }
+        }
+        for (uint64_t i = 0; i < uncompressedTail.size(); i++) {
+            std::cout << "| " << dictionaryValues[uncompressedTail[i]] << " |" << std::endl;
+        }
+    }
+
+    template<class T>
+    size_t HuffmanEncoding<T>::size() const throw () {
+        return blockOffsets.size() * BLOCK_SIZE + uncompressedTail.size();
+    }
+
+    template<class T>
+    const ColumnPtr HuffmanEncoding<T>::copy() const {
+        return ColumnPtr(new HuffmanEncoding<T>(*this));
+    }
+
+    template<class T>
+    void HuffmanEncoding<T>::decode(TID begin, size_t count, T* out) {
+        //a block is decoded from its sync point up to the last value needed from it
+        uint32_t symbols[BLOCK_SIZE];
+        TID end = begin + count;
+        TID tid = begin;
+        while (tid < end && tid / BLOCK_SIZE < blockOffsets.size()) {
+            uint64_t blockIndex = tid / BLOCK_SIZE;
+            TID blockBegin = blockIndex * BLOCK_SIZE;
+            TID blockEnd = std::min(end, blockBegin + BLOCK_SIZE);
+            if (tid == blockBegin) {
+                decodeBlock(blockIndex, blockEnd - blockBegin, out + (tid - begin));
+            } else {
+                decodeSymbols(blockIndex, blockEnd - blockBegin, symbols);
+                for (TID i = tid; i < blockEnd; i++) {
+                    out[i - begin] = dictionaryValues[symbols[i - blockBegin]];
+                }
+            }
+            tid = blockEnd;
+        }
+
+        //the remaining values are looked up from the symbols of the uncompressed tail
+        TID tailBegin = blockOffsets.size() * BLOCK_SIZE;
+        for (; tid < end; tid++) {
+            out[tid - begin] = dictionaryValues[uncompressedTail[tid - tailBegin]];
+        }
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= this->size()) {
+            return false;
+        }
+        uint32_t symbol = getSymbol(boost::any_cast<T>(newValue));
+
+        //the uncompressed tail may span more than one block, if it holds values without code
+        uint64_t blockIndex = tid / BLOCK_SIZE;
+        if (blockIndex >= blockOffsets.size()) {
+            uncompressedTail[tid - blockOffsets.size() * BLOCK_SIZE] = symbol;
+            return true;
+        }
+        //a value without code needs a new code table
+        if (codeLengths[symbol] == 0) {
+            std::vector<uint32_t> symbols;
+            truncate(0, symbols);
+            symbols[tid] = symbol;
+            rebuild(symbols);
+            return true;
+        }
+
+        uint32_t symbols[BLOCK_SIZE];
+        decodeSymbols(blockIndex, BLOCK_SIZE, symbols);
+        symbols[tid % BLOCK_SIZE] = symbol;
+        reencodeBlock(blockIndex, symbols);
+        return true;
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= this->size()) {
+            return false;
+        }
+
+        //decode all symbols from the block of tid on and encode them again without the removed one
+        uint64_t blockIndex = std::min(uint64_t(tid / BLOCK_SIZE), uint64_t(blockOffsets.size()));
+        std::vector<uint32_t> symbols;
+        truncate(blockIndex, symbols);
+        symbols.erase(symbols.begin() + (tid - blockIndex * BLOCK_SIZE));
+        uncompressedTail.swap(symbols);
+        flushTail();
+        return true;
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || this->size() == 0) {
+            return false;
+        }
+        if (tids->back() >= this->size()) {
+            return false;
+        }
+
+        //decode all symbols from the block of the first tid on and encode them again without the removed ones
+        uint64_t blockIndex = std::min(uint64_t(tids->front() / BLOCK_SIZE), uint64_t(blockOffsets.size()));
+        TID base = blockIndex * BLOCK_SIZE;
+        std::vector<uint32_t> symbols;
+        truncate(blockIndex, symbols);
+
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = 0; i < symbols.size(); i++) {
+            if (it != tids->end() && *it == base + i) {
+                ++it;
+            } else {
+                uncompressedTail.push_back(symbols[i]);
+            }
+        }
+        flushTail();
+        return true;
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::clearContent() {
+        dictionary.clear();
+        dictionaryValues.clear();
+        codeLengths.clear();
+        blockOffsets.clear();
+        encodedValues.clear();
+        uncompressedTail.clear();
+        numberOfValuesAtLastBuild = 0;
+        buildCodeTables();
+        return true;
+    }
+
+    template<class T>
+    const PositionListPtr HuffmanEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (T)) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+
+        //evaluate the predicate once per distinct value
+        std::vector<char> matchingSymbols(dictionaryValues.size(), 0);
+        bool anyMatch = false;
+        for (uint32_t symbol = 0; symbol < dictionaryValues.size(); symbol++) {
+            const T& dictionaryValue = dictionaryValues[symbol];
+            matchingSymbols[symbol] = evaluatePredicate(dictionaryValue, value, comp);
+            anyMatch = anyMatch || matchingSymbols[symbol];
+        }
+        if (!anyMatch) {
+            return result_tids;
+        }
+
+        uint32_t symbols[BLOCK_SIZE];
+        for (uint64_t blockIndex = 0; blockIndex < blockOffsets.size(); blockIndex++) {
+            TID base = blockIndex * BLOCK_SIZE;
+            decodeSymbols(blockIndex, BLOCK_SIZE, symbols);
+            //predicated store, every tid is written and only matches advance the output position
+            size_t numberOfResults = result_tids->size();
+            result_tids->resize(numberOfResults + BLOCK_SIZE);
+            TID* out = &(*result_tids)[numberOfResults];
+            unsigned int numberOfMatches = 0;
+            for (unsigned int i = 0; i < BLOCK_SIZE; i++) {
+                out[numberOfMatches] = base + i;
+                numberOfMatches += matchingSymbols[symbols[i]];
+            }
+            result_tids->resize(numberOfResults + numberOfMatches);
+        }
+
+        TID base = blockOffsets.size() * BLOCK_SIZE;
+        for (TID i = 0; i < uncompressedTail.size(); i++) {
+            if (matchingSymbols[uncompressedTail[i]]) {
+                result_tids->push_back(base + i);
+            }
+        }
+        return result_tids;
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << dictionaryValues;
+        oa << codeLengths;
+        oa << blockOffsets;
+        oa << encodedValues;
+        oa << uncompressedTail;
+        oa << numberOfValuesAtLastBuild;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool HuffmanEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> dictionaryValues;
+        ia >> codeLengths;
+        ia >> blockOffsets;
+        ia >> encodedValues;
+        ia >> uncompressedTail;
+        ia >> numberOfValuesAtLastBuild;
+        infile.close();
+
+        //the dictionary map and the decoding tables are derived from the stored values and code lengths
+        dictionary.clear();
+        for (uint32_t symbol = 0; symbol < dictionaryValues.size(); symbol++) {
+            dictionary.insert(std::make_pair(dictionaryValues[symbol], symbol));
+        }
+        buildCodeTables();
+        return true;
+    }
+
+    template<class T>
+    T& HuffmanEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((size_t) tid < this->size()) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int HuffmanEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = dictionaryValues.capacity() * sizeof (T);
+        size_in_bytes += dictionary.size() * (sizeof (T) + sizeof (uint32_t));
+        size_in_bytes += codeLengths.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += encodedValues.capacity() * sizeof (uint64_t);
+        size_in_bytes += uncompressedTail.capacity() * sizeof (uint32_t);
+        size_in_bytes += codes.capacity() * sizeof (uint32_t) + sortedSymbols.capacity() * sizeof (uint32_t);
+        size_in_bytes += lookupTable.capacity() * sizeof (LookupEntry);
+        return size_in_bytes;
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
@@ -0,0 +1,601 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <compression/BitPacking.hpp>
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a patched frame of reference (PFOR) compressed column with type T.
+     *  \details   Like FrameOfReferenceEncoding, each block of BitPacking::BLOCK_SIZE values stores a frame and the bit packed
+     *             differences to that frame. The frame is one of the smallest values of the block and the bit width is chosen
+     *             to minimize the size of the block, so they cover most values. The few values below the frame or with larger
+     *             differences are stored as exceptions next to their position in the block.
+     *             Decoding unpacks the whole block with the branch free kernels and patches the exceptions afterwards.
+     *             T has to be an integral type of at most 32 bits.
+     */
+    template<class T>
+    class PatchedFrameOfReferenceEncoding : public CompressedColumn<T> {
+    public:
+        /*! \brief number of smallest values of a block that are tried as its frame*/
+        static const unsigned int FRAME_CANDIDATES = BitPacking::BLOCK_SIZE / 8;
+
+        /***************** constructors and destructor *****************/
+        PatchedFrameOfReferenceEncoding(const std::string& name, AttributeType db_type);
+        virtual ~PatchedFrameOfReferenceEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief unpacks and patches the blocks covering the range, complete blocks are unpacked in place*/
+        virtual void decode(TID begin, size_t count, T* out);
+
+        /*! \brief filters the column on the packed differences and exceptions, blocks below the predicate range are not unpacked at all*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+
+
+        virtual T& operator[](const int index);
+
+    private:
+
+        /*appends a complete block of values to the packed values*/
+        void packBlock(const T* values);
+        /*replaces the packed values and exceptions of an existing block, which may change its bit width*/
+        void repackBlock(uint64_t blockIndex, const T* values);
+        /*decodes a complete block into values*/
+        void unpackBlock(uint64_t blockIndex, T* values) const;
+        /*removes all blocks starting at blockIndex and returns their values followed by the uncompressed tail*/
+        void truncate(uint64_t blockIndex, std::vector<T>& values);
+        /*returns the size in bits of a block with the given frame and the bit width that minimizes it*/
+        static uint64_t computeBlockCost(const T* values, const T& frame, unsigned int& bits);
+        /*computes the frame, the bit width and the packed differences of a block, values that do not fit are returned as exceptions*/
+        unsigned int computeDifferences(const T* values, T& frame, uint32_t* differences,
+                std::vector<unsigned char>& positions, std::vector<uint32_t>& exceptions) const;
+        /*returns the index of the first exception of a block and the index behind its last exception*/
+        void getExceptionRange(uint64_t blockIndex, uint32_t& begin, uint32_t& end) const;
+
+        const T getValue(TID tid) const;
+
+        /*compressed values structure*/
+        /*vector<[BLOCK_FRAME]>*/
+        std::vector<T> blockFrames;
+        /*vector<[BLOCK_BIT_WIDTH]>*/
+        std::vector<unsigned char> blockBitWidths;
+        /*vector<[WORD_OFFSET_OF_BLOCK]>*/
+        std::vector<uint32_t> blockOffsets;
+        /*bit packed differences of all blocks, followed by a zero guard word*/
+        std::vector<uint64_t> packedValues;
+        /*vector<[INDEX_OF_FIRST_EXCEPTION_OF_BLOCK]>*/
+        std::vector<uint32_t> blockExceptionOffsets;
+        /*vector<[POSITION_IN_BLOCK]>, sorted ascending within each block*/
+        std::vector<unsigned char> exceptionPositions;
+        /*vector<[DIFFERENCE_TO_BLOCK_FRAME]>, the differences of values below the frame wrap around*/
+        std::vector<uint32_t> exceptionValues;
+        /*values of the last, incomplete block*/
+        std::vector<T> uncompressedTail;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    PatchedFrameOfReferenceEncoding<T>::PatchedFrameOfReferenceEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type) {
+
+    }
+
+    template<class T>
+    PatchedFrameOfReferenceEncoding<T>::~PatchedFrameOfReferenceEncoding() {
+
+    }
+
+    template<class T>
+    uint64_t PatchedFrameOfReferenceEncoding<T>::computeBlockCost(const T* values, const T& frame, unsigned int& bits) {
+        //histogram of the needed bit widths of all differences, values below the frame are always exceptions
+        unsigned int numberOfValuesWithBits[33] = {0};
+        unsigned int numberOfValuesBelowFrame = 0;
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            if (values[i] < frame) {
+                numberOfValuesBelowFrame++;
+            } else {
+                numberOfValuesWithBits[BitPacking::getNeededBits((uint32_t) values[i] - (uint32_t) frame)]++;
+            }
+        }
+
+        //pick the bit width with the smallest size of packed values plus exceptions, an exception costs its position and its difference
+        bits = 32;
+        unsigned int numberOfExceptions = numberOfValuesBelowFrame;
+        uint64_t bestCost = uint64_t(32) * BitPacking::BLOCK_SIZE + uint64_t(numberOfExceptions) * (8 + 32);
+        for (int b = 31; b >= 0; b--) {
+            numberOfExceptions += numberOfValuesWithBits[b + 1];
+            uint64_t cost = uint64_t(b) * BitPacking::BLOCK_SIZE + uint64_t(numberOfExceptions) * (8 + 32);
+            if (cost <= bestCost) {
+                bestCost = cost;
+                bits = b;
+            }
+        }
+        return bestCost;
+    }
+
+    template<class T>
+    unsigned int PatchedFrameOfReferenceEncoding<T>::computeDifferences(const T* values, T& frame, uint32_t* differences,
+            std::vector<unsigned char>& positions, std::vector<uint32_t>& exceptions) const {
+        //a few low outliers would widen all differences to the block minimum, so the smallest values are tried as frame
+        T smallestValues[BitPacking::BLOCK_SIZE];
+        std::copy(values, values + BitPacking::BLOCK_SIZE, smallestValues);
+        std::partial_sort(smallestValues, smallestValues + FRAME_CANDIDATES, smallestValues + BitPacking::BLOCK_SIZE);
+        unsigned int bits = 32;
+        uint64_t bestCost = std::numeric_limits<uint64_t>::max();
+        for (unsigned int k = 0; k < FRAME_CANDIDATES; k++) {
+            if (k > 0 && smallestValues[k] == smallestValues[k - 1]) {
+                continue;
+            }
+            unsigned int candidateBits;
+            uint64_t cost = computeBlockCost(values, smallestValues[k], candidateBits);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bits = candidateBits;
+                frame = smallestValues[k];
+            }
+        }
+
+        //exceptions keep a difference of 0 in the packed values
+        uint32_t maxDifference = BitPacking::getMaxValue(bits);
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            differences[i] = (uint32_t) values[i] - (uint32_t) frame;
+            if (values[i] < frame || differences[i] > maxDifference) {
+                positions.push_back(i);
+                exceptions.push_back(differences[i]);
+                differences[i] = 0;
+            }
+        }
+        return bits;
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::packBlock(const T* values) {
+        T frame;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        blockExceptionOffsets.push_back(exceptionPositions.size());
+        unsigned int bits = computeDifferences(values, frame, differences, exceptionPositions, exceptionValues);
+
+        //the new block starts at the position of the current guard word
+        uint32_t offset = packedValues.empty() ? 0 : packedValues.size() - 1;
+        packedValues.resize(offset + bits + 1, 0);
+        BitPacking::packBlock(differences, bits, &packedValues[offset]);
+        packedValues.back() = 0;
+
+        blockFrames.push_back(frame);
+        blockBitWidths.push_back(bits);
+        blockOffsets.push_back(offset);
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::repackBlock(uint64_t blockIndex, const T* values) {
+        T frame;
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        std::vector<unsigned char> positions;
+        std::vector<uint32_t> exceptions;
+        unsigned int bits = computeDifferences(values, frame, differences, positions, exceptions);
+        unsigned int oldBits = blockBitWidths[blockIndex];
+        uint32_t offset = blockOffsets[blockIndex];
+
+        //resize the word range of the block and move all following blocks accordingly
+        if (bits > oldBits) {
+            packedValues.insert(packedValues.begin() + offset + oldBits, bits - oldBits, 0);
+        } else if (bits < oldBits) {
+            packedValues.erase(packedValues.begin() + offset + bits, packedValues.begin() + offset + oldBits);
+        }
+        for (uint64_t i = blockIndex + 1; i < blockOffsets.size(); i++) {
+            blockOffsets[i] = blockOffsets[i] + bits - oldBits;
+        }
+        BitPacking::packBlock(differences, bits, &packedValues[offset]);
+
+        //replace the exceptions of the block
+        uint32_t begin, end;
+        getExceptionRange(blockIndex, begin, end);
+        exceptionPositions.erase(exceptionPositions.begin() + begin, exceptionPositions.begin() + end);
+        exceptionPositions.insert(exceptionPositions.begin() + begin, positions.begin(), positions.end());
+        exceptionValues.erase(exceptionValues.begin() + begin, exceptionValues.begin() + end);
+        exceptionValues.insert(exceptionValues.begin() + begin, exceptions.begin(), exceptions.end());
+        for (uint64_t i = blockIndex + 1; i < blockExceptionOffsets.size(); i++) {
+            blockExceptionOffsets[i] = blockExceptionOffsets[i] + positions.size() - (end - begin);
+        }
+
+        blockFrames[blockIndex] = frame;
+        blockBitWidths[blockIndex] = bits;
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::getExceptionRange(uint64_t blockIndex, uint32_t& begin, uint32_t& end) const {
+        begin = blockExceptionOffsets[blockIndex];
+        end = (blockIndex + 1 < blockExceptionOffsets.size()) ? blockExceptionOffsets[blockIndex + 1] : exceptionPositions.size();
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::unpackBlock(uint64_t blockIndex, T* values) const {
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+        BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+        //patch the exceptions
+        uint32_t begin, end;
+        getExceptionRange(blockIndex, begin, end);
+        for (uint32_t i = begin; i < end; i++) {
+            differences[exceptionPositions[i]] = exceptionValues[i];
+        }
+        uint32_t frame = (uint32_t) blockFrames[blockIndex];
+        for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+            values[i] = (T) (differences[i] + frame);
+        }
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::truncate(uint64_t blockIndex, std::vector<T>& values) {
+        uint64_t numberOfBlocks = blockFrames.size();
+        values.resize((numberOfBlocks - blockIndex) * BitPacking::BLOCK_SIZE);
+        for (uint64_t i = blockIndex; i < numberOfBlocks; i++) {
+            unpackBlock(i, &values[(i - blockIndex) * BitPacking::BLOCK_SIZE]);
+        }
+        values.insert(values.end(), uncompressedTail.begin(), uncompressedTail.end());
+
+        if (blockIndex < numberOfBlocks) {
+            packedValues.resize(blockOffsets[blockIndex] + 1);
+            packedValues.back() = 0;
+            exceptionPositions.resize(blockExceptionOffsets[blockIndex]);
+            exceptionValues.resize(blockExceptionOffsets[blockIndex]);
+        }
+        if (blockIndex == 0) {
+            packedValues.clear();
+        }
+        blockFrames.resize(blockIndex);
+        blockBitWidths.resize(blockIndex);
+        blockOffsets.resize(blockIndex);
+        blockExceptionOffsets.resize(blockIndex);
+        uncompressedTail.clear();
+    }
+
+    template<class T>
+    const T PatchedFrameOfReferenceEncoding<T>::getValue(TID tid) const {
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex >= blockFrames.size()) {
+            return uncompressedTail[tid - blockFrames.size() * BitPacking::BLOCK_SIZE];
+        }
+
+        unsigned char position = tid % BitPacking::BLOCK_SIZE;
+        uint32_t begin, end;
+        getExceptionRange(blockIndex, begin, end);
+        std::vector<unsigned char>::const_iterator exception = std::lower_bound(exceptionPositions.begin() + begin, exceptionPositions.begin() + end, position);
+        if (exception != exceptionPositions.begin() + end && *exception == position) {
+            return (T) (exceptionValues[exception - exceptionPositions.begin()] + (uint32_t) blockFrames[blockIndex]);
+        }
+        uint32_t difference = BitPacking::extract(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], position);
+        return (T) (difference + (uint32_t) blockFrames[blockIndex]);
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::insert(const T& newValue) {
+        uncompressedTail.push_back(newValue);
+        //compress the tail as soon as it fills a complete block
+        if (uncompressedTail.size() == BitPacking::BLOCK_SIZE) {
+            packBlock(&uncompressedTail[0]);
+            uncompressedTail.clear();
+        }
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool PatchedFrameOfReferenceEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any PatchedFrameOfReferenceEncoding<T>::get(TID tid) {
+        if (tid < this->size()) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        for (TID i = 0; i < this->size(); i++) {
+            std::cout << "| " << getValue(i) << " |" << std::endl;
+        }
+    }
+
+    template<class T>
+    size_t PatchedFrameOfReferenceEncoding<T>::size() const throw () {
+        return blockFrames.size() * BitPacking::BLOCK_SIZE + uncompressedTail.size();
+    }
+
+    template<class T>
+    const ColumnPtr PatchedFrameOfReferenceEncoding<T>::copy() const {
+        return ColumnPtr(new PatchedFrameOfReferenceEncoding<T>(*this));
+    }
+
+    template<class T>
+    void PatchedFrameOfReferenceEncoding<T>::decode(TID begin, size_t count, T* out) {
+        BitPacking::decodeBlocks(*this, &PatchedFrameOfReferenceEncoding<T>::unpackBlock, blockFrames.size(), uncompressedTail, begin, count, out);
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= this->size()) {
+            return false;
+        }
+        T value = boost::any_cast<T>(newValue);
+
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        if (blockIndex == blockFrames.size()) {
+            uncompressedTail[tid % BitPacking::BLOCK_SIZE] = value;
+            return true;
+        }
+
+        //decode the block, change the value and pack the block again
+        T values[BitPacking::BLOCK_SIZE];
+        unpackBlock(blockIndex, values);
+        values[tid % BitPacking::BLOCK_SIZE] = value;
+        repackBlock(blockIndex, values);
+        return true;
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of tid on and compress them again without the removed value
+        uint64_t blockIndex = tid / BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+        values.erase(values.begin() + (tid - blockIndex * BitPacking::BLOCK_SIZE));
+        return this->insert(values.begin(), values.end());
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || this->size() == 0) {
+            return false;
+        }
+        if (tids->back() >= this->size()) {
+            return false;
+        }
+
+        //decode all values from the block of the first tid on and compress them again without the removed values
+        uint64_t blockIndex = tids->front() / BitPacking::BLOCK_SIZE;
+        TID base = blockIndex * BitPacking::BLOCK_SIZE;
+        std::vector<T> values;
+        truncate(blockIndex, values);
+
+        std::vector<T> remainingValues;
+        remainingValues.reserve(values.size());
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = 0; i < values.size(); i++) {
+            if (it != tids->end() && *it == base + i) {
+                ++it;
+            } else {
+                remainingValues.push_back(values[i]);
+            }
+        }
+        return this->insert(remainingValues.begin(), remainingValues.end());
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::clearContent() {
+        blockFrames.clear();
+        blockBitWidths.clear();
+        blockOffsets.clear();
+        packedValues.clear();
+        blockExceptionOffsets.clear();
+        exceptionPositions.clear();
+        exceptionValues.clear();
+        uncompressedTail.clear();
+        return true;
+    }
+
+    template<class T>
+    const PositionListPtr PatchedFrameOfReferenceEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        //prefix and substring predicates only apply to strings, the generic selection rejects them
+        if (value_for_comparison.type() != typeid (T) || comp == PREFIX || comp == SUBSTRING) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+        uint32_t differences[BitPacking::BLOCK_SIZE];
+
+        for (uint64_t blockIndex = 0; blockIndex < blockFrames.size(); blockIndex++) {
+            TID base = blockIndex * BitPacking::BLOCK_SIZE;
+            //every comparator selects a range [lower,upper) of differences to the block frame
+            int64_t reference = int64_t(value) - int64_t(blockFrames[blockIndex]);
+            int64_t lower = 0;
+            int64_t upper = int64_t(1) << 32;
+            if (comp == EQUAL) {
+                lower = reference;
+                upper = reference + 1;
+            } else if (comp == LESSER) {
+                upper = reference;
+            } else if (comp == GREATER) {
+                lower = reference + 1;
+            } else {
+                upper = lower;
+            }
+            lower = std::max(lower, int64_t(0));
+
+            //the packed differences are compared with one unsigned range check per value, an empty range may still match exceptions
+            uint64_t matches = 0;
+            int64_t maxDifference = BitPacking::getMaxValue(blockBitWidths[blockIndex]);
+            if (lower < upper && lower == 0 && upper > maxDifference) {
+                matches = ~uint64_t(0);
+            } else if (lower < upper && lower <= maxDifference) {
+                BitPacking::unpackBlock(&packedValues[blockOffsets[blockIndex]], blockBitWidths[blockIndex], differences);
+                uint32_t rangeStart = lower;
+                uint32_t rangeWidth = std::min(upper, maxDifference + 1) - lower;
+                for (unsigned int i = 0; i < BitPacking::BLOCK_SIZE; i++) {
+                    matches |= uint64_t(differences[i] - rangeStart < rangeWidth) << i;
+                }
+            }
+
+            //exceptions are evaluated on their values, as the differences of values below the frame wrap around
+            uint32_t begin, end;
+            getExceptionRange(blockIndex, begin, end);
+            for (uint32_t i = begin; i < end; i++) {
+                bool match = evaluatePredicate((T) (exceptionValues[i] + (uint32_t) blockFrames[blockIndex]), value, comp);
+                matches = (matches & ~(uint64_t(1) << exceptionPositions[i])) | (uint64_t(match) << exceptionPositions[i]);
+            }
+
+            while (matches != 0) {
+                result_tids->push_back(base + __builtin_ctzll(matches));
+                matches &= matches - 1;
+            }
+        }
+
+        //the values of the incomplete block are compared directly
+        TID base = blockFrames.size() * BitPacking::BLOCK_SIZE;
+        for (TID i = 0; i < uncompressedTail.size(); i++) {
+            if (evaluatePredicate(uncompressedTail[i], value, comp)) {
+                result_tids->push_back(base + i);
+            }
+        }
+
+        return result_tids;
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << blockFrames;
+        oa << blockBitWidths;
+        oa << blockOffsets;
+        oa << packedValues;
+        oa << blockExceptionOffsets;
+        oa << exceptionPositions;
+        oa << exceptionValues;
+        oa << uncompressedTail;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool PatchedFrameOfReferenceEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> blockFrames;
+        ia >> blockBitWidths;
+        ia >> blockOffsets;
+        ia >> packedValues;
+        ia >> blockExceptionOffsets;
+        ia >> exceptionPositions;
+        ia >> exceptionValues;
+        ia >> uncompressedTail;
+
+        infile.close();
+        return true;
+    }
+
+    template<class T>
+    T& PatchedFrameOfReferenceEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((size_t) tid < this->size()) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int PatchedFrameOfReferenceEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = blockFrames.capacity() * sizeof (T);
+        size_in_bytes += blockBitWidths.capacity() * sizeof (unsigned char);
+        size_in_bytes += blockOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += packedValues.capacity() * sizeof (uint64_t);
+        size_in_bytes += blockExceptionOffsets.capacity() * sizeof (uint32_t);
+        size_in_bytes += exceptionPositions.capacity() * sizeof (unsigned char);
+        size_in_bytes += exceptionValues.capacity() * sizeof (uint32_t);
+        size_in_bytes += uncompressedTail.capacity() * sizeof (T);
+        return size_in_bytes;
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
@@ -35,15 +35,60 @@ namespace CoGaDB {
 
         virtual const ColumnPtr copy() const;
 
+        /*! \brief finds the run containing begin once and fills the range run by run*/
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief returns a cursor that keeps the current run, so a scan is linear in the number of values and runs*/
+        virtual typename ColumnBaseTyped<T>::ColumnCursorPtr createCursor();
+        /*! \brief merges an ascending TID list with the runs in one pass, other lists are sorted first*/
+        virtual void gather(const PositionList& tids, T* out);
+        /*! \brief sorts the runs by their values and expands every run to its range of TIDs*/
+        virtual const PositionListPtr sort(SortOrder order);
+        /*! \brief returns the start of the first run that starts at or behind tid, so no run is split between two chunks*/
+        virtual TID getChunkBoundary(TID tid);
+
+        /*! \brief merges the sorted runs of two run length encoded columns, other columns are joined by the generic sort merge join*/
+        virtual const PositionListPairPtr sort_merge_join(ColumnPtr join_column);
+        /*! \brief run length encoded columns join each other with sort_merge_join() on their runs*/
+        virtual bool hasCompressedJoin(ColumnBaseTyped<T>& join_column, JoinAlgorithm& algorithm);
+        /*! \brief compares the values of neighbouring runs*/
+        virtual bool isSorted();
+
+        /*! \brief compares each run once and emits the TIDs of all matching runs*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+        /*! \brief tests each run once against the filter and emits the TIDs of all passing runs*/
+        virtual const PositionListPtr filter_selection(const JoinFilter<T>& filter);
+        /*! \brief transforms the value of each run once and merges neighbouring runs that became equal*/
+        virtual bool transformValues(ArithmeticOperation operation, const T& constant);
+
         virtual bool store(const std::string& path);
         virtual bool load(const std::string& path);
 
 
 
+        /*! \brief returns a reference to the value of the run containing index, writes have to use update()*/
         virtual T& operator[](const int index);
 
     private:
 
+        //returns the run indices ordered by their values and the first TID of every run, runBegins has one additional entry
+        //holding the end of the last run
+        void getSortedRuns(SortOrder order, PositionList& runOrder, std::vector<TID>& runBegins) const;
+
+        /*cursor over the runs, which remembers the run of the last decoded value*/
+        class Cursor : public ColumnCursor<T> {
+        public:
+            Cursor(const RunLengthEncoding<T>& column);
+
+        protected:
+            virtual void decodeNext(TID begin, size_t count, T* out);
+
+        private:
+            const RunLengthEncoding<T>& column;
+            /*index of the current run and TID of its first value*/
+            uint64_t run;
+            TID runBegin;
+        };
+
         /*compressed values structure*/
         /*vector<pair<[RUN_LENGTH],[VALUE]> >*/
         std::vector<std::pair<uint64_t, T> > compressedValues;
@@ -170,6 +215,60 @@ namespace CoGaDB {
         return ColumnPtr(new RunLengthEncoding<T>(*this));
     }
 
+    template<class T>
+    void RunLengthEncoding<T>::decode(TID begin, size_t count, T* out) {
+        //skip all runs that end before begin
+        uint64_t run = 0;
+        TID runBegin = 0;
+        while (run < compressedValues.size() && runBegin + compressedValues[run].first <= begin) {
+            runBegin += compressedValues[run].first;
+            run++;
+        }
+
+        //every run covers the values from the current position up to its end
+        TID tid = begin;
+        TID end = begin + count;
+        while (tid < end && run < compressedValues.size()) {
+            TID runEnd = std::min(end, (TID) (runBegin + compressedValues[run].first));
+            std::fill(out + (tid - begin), out + (runEnd - begin), compressedValues[run].second);
+            tid = runEnd;
+            runBegin += compressedValues[run].first;
+            run++;
+        }
+    }
+
+    template<class T>
+    typename ColumnBaseTyped<T>::ColumnCursorPtr RunLengthEncoding<T>::createCursor() {
+        return typename ColumnBaseTyped<T>::ColumnCursorPtr(new Cursor(*this));
+    }
+
+    template<class T>
+    TID RunLengthEncoding<T>::getChunkBoundary(TID tid) {
+        TID runBegin = 0;
+        for (uint64_t run = 0; run < compressedValues.size() && runBegin < tid; run++) {
+            runBegin += compressedValues[run].first;
+        }
+        return runBegin;
+    }
+
+    template<class T>
+    void RunLengthEncoding<T>::gather(const PositionList& tids, T* out) {
+        if (!isSortedAscending(tids)) {
+            ColumnBaseTyped<T>::gather(tids, out);
+            return;
+        }
+        //the current run only moves forward, so every run is visited once
+        uint64_t run = 0;
+        TID runEnd = compressedValues.empty() ? 0 : compressedValues[0].first;
+        for (size_t i = 0; i < tids.size(); i++) {
+            while (tids[i] >= runEnd && run + 1 < compressedValues.size()) {
+                run++;
+                runEnd += compressedValues[run].first;
+            }
+            out[i] = compressedValues[run].second;
+        }
+    }
+
     template<class T>
     bool RunLengthEncoding<T>::update(TID tid, const boost::any& newValue) {
         //check for empty compressed column, or different type value
@@ -337,6 +436,44 @@ namespace CoGaDB {
         return true;
     }
 
+    template<class T>
+    const PositionListPtr RunLengthEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (T)) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+        TID runStart = 0;
+        for (uint64_t i = 0; i < compressedValues.size(); i++) {
+            const T& runValue = compressedValues[i].second;
+            TID runEnd = runStart + compressedValues[i].first;
+            if (evaluatePredicate(runValue, value, comp)) {
+                for (TID tid = runStart; tid < runEnd; tid++) {
+                    result_tids->push_back(tid);
+                }
+            }
+            runStart = runEnd;
+        }
+        return result_tids;
+    }
+
+    template<class T>
+    const PositionListPtr RunLengthEncoding<T>::filter_selection(const JoinFilter<T>& filter) {
+        PositionListPtr result_tids(new PositionList());
+        TID runStart = 0;
+        for (uint64_t i = 0; i < compressedValues.size(); i++) {
+            TID runEnd = runStart + compressedValues[i].first;
+            if (filter.mayContain(compressedValues[i].second)) {
+                for (TID tid = runStart; tid < runEnd; tid++) {
+                    result_tids->push_back(tid);
+                }
+            }
+            runStart = runEnd;
+        }
+        return result_tids;
+    }
+
     template<class T>
     bool RunLengthEncoding<T>::store(const std::string& path_) {
         std::string path(path_);
@@ -397,6 +534,157 @@ namespace CoGaDB {
         }
         return size_in_bytes;
     }
+    template<class T>
+    RunLengthEncoding<T>::Cursor::Cursor(const RunLengthEncoding<T>& column) : ColumnCursor<T>(column.size()), column(column), run(0), runBegin(0) {
+
+    }
+
+    template<class T>
+    void RunLengthEncoding<T>::Cursor::decodeNext(TID begin, size_t count, T* out) {
+        const std::vector<std::pair<uint64_t, T> >& runs = column.compressedValues;
+        //runs ending before begin are skipped, starting at the current run
+        while (run < runs.size() && runBegin + runs[run].first <= begin) {
+            runBegin += runs[run].first;
+            run++;
+        }
+
+        TID tid = begin;
+        TID end = begin + count;
+        while (tid < end) {
+            TID runEnd = runBegin + runs[run].first;
+            TID last = std::min(end, runEnd);
+            std::fill(out + (tid - begin), out + (last - begin), runs[run].second);
+            tid = last;
+            //the run stays current if the batch ends inside of it
+            if (last == runEnd) {
+                runBegin = runEnd;
+                run++;
+            }
+        }
+    }
+
+    template<class T>
+    const PositionListPtr RunLengthEncoding<T>::sort(SortOrder order) {
+        if (order != ASCENDING && order != DESCENDING) {
+            return ColumnBaseTyped<T>::sort(order);
+        }
+
+        PositionList runOrder;
+        std::vector<TID> runBegins;
+        this->getSortedRuns(order, runOrder, runBegins);
+
+        PositionListPtr ids(new PositionList());
+        ids->reserve(runBegins.back());
+        for (uint64_t i = 0; i < runOrder.size(); i++) {
+            for (TID tid = runBegins[runOrder[i]]; tid < runBegins[runOrder[i] + 1]; tid++) {
+                ids->push_back(tid);
+            }
+        }
+        return ids;
+    }
+
+    template<class T>
+    void RunLengthEncoding<T>::getSortedRuns(SortOrder order, PositionList& runOrder, std::vector<TID>& runBegins) const {
+        runBegins.assign(compressedValues.size() + 1, 0);
+        boost::scoped_array<T> runValues(new T[compressedValues.size()]);
+        for (uint64_t i = 0; i < compressedValues.size(); i++) {
+            runBegins[i + 1] = runBegins[i] + compressedValues[i].first;
+            runValues[i] = compressedValues[i].second;
+        }
+        //the sort is stable, so runs of equal values and with them their TIDs stay ascending
+        sortPositions(runValues.get(), compressedValues.size(), order, runOrder, NULL);
+    }
+
+    template<class T>
+    const PositionListPairPtr RunLengthEncoding<T>::sort_merge_join(ColumnPtr join_column) {
+        RunLengthEncoding<T>* join_rle = dynamic_cast<RunLengthEncoding<T>*> (join_column.get());
+        if (join_rle == NULL) {
+            return ColumnBaseTyped<T>::sort_merge_join(join_column);
+        }
+
+        PositionListPairPtr join_tids(new PositionListPair());
+        join_tids->first = PositionListPtr(new PositionList());
+        join_tids->second = PositionListPtr(new PositionList());
+
+        //the runs of both columns are merged by value, every pair of runs with equal values joins all TIDs of their ranges
+        PositionList runOrder;
+        PositionList joinRunOrder;
+        std::vector<TID> runBegins;
+        std::vector<TID> joinRunBegins;
+        this->getSortedRuns(ASCENDING, runOrder, runBegins);
+        join_rle->getSortedRuns(ASCENDING, joinRunOrder, joinRunBegins);
+        size_t run = 0;
+        size_t joinRun = 0;
+        while (run < runOrder.size() && joinRun < joinRunOrder.size()) {
+            const T& value = compressedValues[runOrder[run]].second;
+            const T& joinValue = join_rle->compressedValues[joinRunOrder[joinRun]].second;
+            if (value < joinValue) {
+                run++;
+            } else if (joinValue < value) {
+                joinRun++;
+            } else {
+                size_t runEnd = run + 1;
+                while (runEnd < runOrder.size() && !(value < compressedValues[runOrder[runEnd]].second)) {
+                    runEnd++;
+                }
+                size_t joinRunEnd = joinRun + 1;
+                while (joinRunEnd < joinRunOrder.size() && !(joinValue < join_rle->compressedValues[joinRunOrder[joinRunEnd]].second)) {
+                    joinRunEnd++;
+                }
+                for (size_t r = run; r < runEnd; r++) {
+                    for (TID tid = runBegins[runOrder[r]]; tid < runBegins[runOrder[r] + 1]; tid++) {
+                        for (size_t j = joinRun; j < joinRunEnd; j++) {
+                            TID joinBegin = joinRunBegins[joinRunOrder[j]];
+                            TID joinEnd = joinRunBegins[joinRunOrder[j] + 1];
+                            join_tids->first->insert(join_tids->first->end(), joinEnd - joinBegin, tid);
+                            for (TID joinTid = joinBegin; joinTid < joinEnd; joinTid++) {
+                                join_tids->second->push_back(joinTid);
+                            }
+                        }
+                    }
+                }
+                run = runEnd;
+                joinRun = joinRunEnd;
+            }
+        }
+        return join_tids;
+    }
+
+    template<class T>
+    bool RunLengthEncoding<T>::hasCompressedJoin(ColumnBaseTyped<T>& join_column, JoinAlgorithm& algorithm) {
+        if (dynamic_cast<RunLengthEncoding<T>*> (&join_column) == NULL) {
+            return false;
+        }
+        algorithm = SORT_MERGE_JOIN;
+        return true;
+    }
+
+    template<class T>
+    bool RunLengthEncoding<T>::isSorted() {
+        for (uint64_t i = 1; i < compressedValues.size(); i++) {
+            if (compressedValues[i].second < compressedValues[i - 1].second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool RunLengthEncoding<T>::transformValues(ArithmeticOperation operation, const T& constant) {
+        uint64_t numberOfRuns = 0;
+        for (uint64_t i = 0; i < compressedValues.size(); i++) {
+            T value = applyArithmeticOperation(compressedValues[i].second, constant, operation);
+            if (numberOfRuns > 0 && compressedValues[numberOfRuns - 1].second == value) {
+                compressedValues[numberOfRuns - 1].first += compressedValues[i].first;
+            } else {
+                compressedValues[numberOfRuns] = std::make_pair(compressedValues[i].first, value);
+                numberOfRuns++;
+            }
+        }
+        compressedValues.resize(numberOfRuns);
+        return true;
+    }
+
     /***************** End of Implementation Section ******************/
 
 
@@ -0,0 +1,492 @@
+#pragma once
+
+#include <core/compressed_column.hpp>
+#include <algorithm>
+#include <map>
+#include <fstream>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a sparse compressed column with type T.
+     *  \details   The column stores one default value and a list of exceptions, which are the positions and values of all rows
+     *             that differ from the default value, sorted by position. Point reads binary search the exception positions, and
+     *             selections that match the default value are evaluated as the complement of the non matching exceptions.
+     *             The most frequent value becomes the default value whenever the exceptions make up more than half of the column,
+     *             which is checked each time the column doubled in size.
+     */
+    template<class T>
+    class SparseEncoding : public CompressedColumn<T> {
+    public:
+        /***************** constructors and destructor *****************/
+        SparseEncoding(const std::string& name, AttributeType db_type);
+        virtual ~SparseEncoding();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const T& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief fills the range with the default value and patches the exceptions inside it*/
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief returns a cursor that keeps the position of the next exception*/
+        virtual typename ColumnBaseTyped<T>::ColumnCursorPtr createCursor();
+        /*! \brief merges an ascending TID list with the exception positions, other lists search every TID*/
+        virtual void gather(const PositionList& tids, T* out);
+
+        /*! \brief filters the exceptions, a matching default value turns the result into the complement of the non matching exceptions*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+
+        /*! \brief returns the value of all rows that are not stored as exception*/
+        const T& getDefaultValue() const throw ();
+        /*! \brief returns the number of rows that differ from the default value*/
+        size_t getNumberOfExceptions() const throw ();
+
+        virtual T& operator[](const int index);
+
+    private:
+
+        /*makes the most frequent value the default value and recomputes the exceptions*/
+        void chooseDefaultValue();
+
+        const T& getValue(TID tid) const;
+
+        /*cursor over the exceptions, which remembers the first exception behind the last batch*/
+        class Cursor : public ColumnCursor<T> {
+        public:
+            Cursor(const SparseEncoding<T>& column);
+
+        protected:
+            virtual void decodeNext(TID begin, size_t count, T* out);
+
+        private:
+            const SparseEncoding<T>& column;
+            uint64_t exception;
+        };
+
+        /*compressed values structure*/
+        T defaultValue;
+        /*vector<[TID]>, sorted ascending*/
+        std::vector<TID> exceptionPositions;
+        /*vector<[VALUE]>*/
+        std::vector<T> exceptionValues;
+        uint64_t numberOfValues;
+        /*number of values when the default value was chosen the last time*/
+        uint64_t numberOfValuesAtLastChoice;
+
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+
+    template<class T>
+    SparseEncoding<T>::SparseEncoding(const std::string& name, AttributeType db_type) : CompressedColumn<T>(name, db_type), defaultValue(), exceptionPositions(), exceptionValues(), numberOfValues(0), numberOfValuesAtLastChoice(0) {
+
+    }
+
+    template<class T>
+    SparseEncoding<T>::~SparseEncoding() {
+
+    }
+
+    template<class T>
+    void SparseEncoding<T>::chooseDefaultValue() {
+        numberOfValuesAtLastChoice = numberOfValues;
+
+        //count the exception values, all other rows hold the default value
+        std::map<T, uint64_t> frequencies;
+        for (uint64_t i = 0; i < exceptionValues.size(); i++) {
+            frequencies[exceptionValues[i]]++;
+        }
+        typename std::map<T, uint64_t>::const_iterator mostFrequent = frequencies.begin();
+        for (typename std::map<T, uint64_t>::const_iterator it = frequencies.begin(); it != frequencies.end(); it++) {
+            if (it->second > mostFrequent->second) {
+                mostFrequent = it;
+            }
+        }
+        if (mostFrequent == frequencies.end() || mostFrequent->second <= numberOfValues - exceptionValues.size()) {
+            return;
+        }
+
+        //rows with the old default value become exceptions, rows with the new one stop being exceptions
+        T newDefaultValue = mostFrequent->first;
+        std::vector<TID> newPositions;
+        std::vector<T> newValues;
+        uint64_t exception = 0;
+        for (TID tid = 0; tid < numberOfValues; tid++) {
+            const T& value = (exception < exceptionPositions.size() && exceptionPositions[exception] == tid)
+                    ? exceptionValues[exception++] : defaultValue;
+            if (value != newDefaultValue) {
+                newPositions.push_back(tid);
+                newValues.push_back(value);
+            }
+        }
+        defaultValue = newDefaultValue;
+        exceptionPositions.swap(newPositions);
+        exceptionValues.swap(newValues);
+    }
+
+    template<class T>
+    const T& SparseEncoding<T>::getValue(TID tid) const {
+        std::vector<TID>::const_iterator it = std::lower_bound(exceptionPositions.begin(), exceptionPositions.end(), tid);
+        if (it != exceptionPositions.end() && *it == tid) {
+            return exceptionValues[it - exceptionPositions.begin()];
+        }
+        return defaultValue;
+    }
+
+    template<class T>
+    const T& SparseEncoding<T>::getDefaultValue() const throw () {
+        return defaultValue;
+    }
+
+    template<class T>
+    size_t SparseEncoding<T>::getNumberOfExceptions() const throw () {
+        return exceptionPositions.size();
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (T) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<T>(newValue));
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::insert(const T& newValue) {
+        //the first value of an empty column becomes the default value
+        if (numberOfValues == 0) {
+            defaultValue = newValue;
+        }
+        if (newValue != defaultValue) {
+            exceptionPositions.push_back(numberOfValues);
+            exceptionValues.push_back(newValue);
+        }
+        numberOfValues++;
+
+        if (exceptionPositions.size() * 2 > numberOfValues && numberOfValues >= 2 * numberOfValuesAtLastChoice) {
+            chooseDefaultValue();
+        }
+        return true;
+    }
+
+    template <typename T>
+    template <typename InputIterator>
+    bool SparseEncoding<T>::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    const boost::any SparseEncoding<T>::get(TID tid) {
+        if (tid < numberOfValues) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    template<class T>
+    void SparseEncoding<T>::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        uint64_t exception = 0;
+        for (TID tid = 0; tid < numberOfValues; tid++) {
+            if (exception < exceptionPositions.size() && exceptionPositions[exception] == tid) {
+                std::cout << "| " << exceptionValues[exception++] << " |" << std::endl;
+            } else {
+                std::cout << "| " << defaultValue << " |" << std::endl;
+            }
+        }
+    }
+
+    template<class T>
+    size_t SparseEncoding<T>::size() const throw () {
+        return numberOfValues;
+    }
+
+    template<class T>
+    const ColumnPtr SparseEncoding<T>::copy() const {
+        return ColumnPtr(new SparseEncoding<T>(*this));
+    }
+
+    template<class T>
+    void SparseEncoding<T>::decode(TID begin, size_t count, T* out) {
+        std::fill(out, out + count, defaultValue);
+        //the exceptions of the range are found by a binary search for its first TID
+        std::vector<TID>::const_iterator it = std::lower_bound(exceptionPositions.begin(), exceptionPositions.end(), begin);
+        for (; it != exceptionPositions.end() && *it < begin + count; ++it) {
+            out[*it - begin] = exceptionValues[it - exceptionPositions.begin()];
+        }
+    }
+
+    template<class T>
+    typename ColumnBaseTyped<T>::ColumnCursorPtr SparseEncoding<T>::createCursor() {
+        return typename ColumnBaseTyped<T>::ColumnCursorPtr(new Cursor(*this));
+    }
+
+    template<class T>
+    void SparseEncoding<T>::gather(const PositionList& tids, T* out) {
+        if (!isSortedAscending(tids)) {
+            for (size_t i = 0; i < tids.size(); i++) {
+                std::vector<TID>::const_iterator it = std::lower_bound(exceptionPositions.begin(), exceptionPositions.end(), tids[i]);
+                out[i] = (it != exceptionPositions.end() && *it == tids[i]) ? exceptionValues[it - exceptionPositions.begin()] : defaultValue;
+            }
+            return;
+        }
+        uint64_t exception = 0;
+        for (size_t i = 0; i < tids.size(); i++) {
+            while (exception < exceptionPositions.size() && exceptionPositions[exception] < tids[i]) {
+                exception++;
+            }
+            out[i] = (exception < exceptionPositions.size() && exceptionPositions[exception] == tids[i]) ? exceptionValues[exception] : defaultValue;
+        }
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (T) != newValue.type() || tid >= numberOfValues) {
+            return false;
+        }
+        T value = boost::any_cast<T>(newValue);
+
+        std::vector<TID>::iterator it = std::lower_bound(exceptionPositions.begin(), exceptionPositions.end(), tid);
+        uint64_t index = it - exceptionPositions.begin();
+        if (it != exceptionPositions.end() && *it == tid) {
+            //an exception is either changed or becomes a default row again
+            if (value == defaultValue) {
+                exceptionPositions.erase(it);
+                exceptionValues.erase(exceptionValues.begin() + index);
+            } else {
+                exceptionValues[index] = value;
+            }
+        } else if (value != defaultValue) {
+            exceptionPositions.insert(it, tid);
+            exceptionValues.insert(exceptionValues.begin() + index, value);
+        }
+        return true;
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (T) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= numberOfValues) {
+            return false;
+        }
+
+        std::vector<TID>::iterator it = std::lower_bound(exceptionPositions.begin(), exceptionPositions.end(), tid);
+        if (it != exceptionPositions.end() && *it == tid) {
+            exceptionValues.erase(exceptionValues.begin() + (it - exceptionPositions.begin()));
+            it = exceptionPositions.erase(it);
+        }
+        //all following exceptions move one row up
+        for (; it != exceptionPositions.end(); it++) {
+            (*it)--;
+        }
+        numberOfValues--;
+        return true;
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::remove(PositionListPtr tids) {
+        //check for empty tid list or empty compressed column
+        if (!tids || tids->empty() || numberOfValues == 0) {
+            return false;
+        }
+        if (tids->back() >= numberOfValues) {
+            return false;
+        }
+
+        //merge the exceptions with the removed tids, every exception moves up by the number of removed rows before it
+        uint64_t numberOfRemovedRows = 0;
+        uint64_t numberOfKeptExceptions = 0;
+        PositionList::const_iterator removed = tids->begin();
+        for (uint64_t i = 0; i < exceptionPositions.size(); i++) {
+            while (removed != tids->end() && *removed < exceptionPositions[i]) {
+                ++removed;
+                numberOfRemovedRows++;
+            }
+            if (removed != tids->end() && *removed == exceptionPositions[i]) {
+                continue;
+            }
+            exceptionPositions[numberOfKeptExceptions] = exceptionPositions[i] - numberOfRemovedRows;
+            exceptionValues[numberOfKeptExceptions] = exceptionValues[i];
+            numberOfKeptExceptions++;
+        }
+        exceptionPositions.resize(numberOfKeptExceptions);
+        exceptionValues.resize(numberOfKeptExceptions);
+        numberOfValues -= tids->size();
+        return true;
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::clearContent() {
+        defaultValue = T();
+        exceptionPositions.clear();
+        exceptionValues.clear();
+        numberOfValues = 0;
+        numberOfValuesAtLastChoice = 0;
+        return true;
+    }
+
+    template<class T>
+    const PositionListPtr SparseEncoding<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (T)) {
+            return ColumnBaseTyped<T>::selection(value_for_comparison, comp);
+        }
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        PositionListPtr result_tids(new PositionList());
+        bool defaultMatches = evaluatePredicate(defaultValue, value, comp);
+
+        if (!defaultMatches) {
+            //only exceptions can match
+            for (uint64_t i = 0; i < exceptionPositions.size(); i++) {
+                if (evaluatePredicate(exceptionValues[i], value, comp)) {
+                    result_tids->push_back(exceptionPositions[i]);
+                }
+            }
+            return result_tids;
+        }
+
+        //all rows match except the exceptions that do not match
+        result_tids->reserve(numberOfValues);
+        TID begin = 0;
+        for (uint64_t i = 0; i < exceptionPositions.size(); i++) {
+            bool match = evaluatePredicate(exceptionValues[i], value, comp);
+            if (!match) {
+                for (TID tid = begin; tid < exceptionPositions[i]; tid++) {
+                    result_tids->push_back(tid);
+                }
+                begin = exceptionPositions[i] + 1;
+            }
+        }
+        for (TID tid = begin; tid < numberOfValues; tid++) {
+            result_tids->push_back(tid);
+        }
+        return result_tids;
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << defaultValue;
+        oa << exceptionPositions;
+        oa << exceptionValues;
+        oa << numberOfValues;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    template<class T>
+    bool SparseEncoding<T>::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> defaultValue;
+        ia >> exceptionPositions;
+        ia >> exceptionValues;
+        ia >> numberOfValues;
+        numberOfValuesAtLastChoice = numberOfValues;
+
+        infile.close();
+        return true;
+    }
+
+    template<class T>
+    T& SparseEncoding<T>::operator[](const int tid) {
+        static T t;
+        //check for out of range tid
+        if ((uint64_t) tid < numberOfValues) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    template<class T>
+    unsigned int SparseEncoding<T>::getSizeinBytes() const throw () {
+        uint64_t size_in_bytes = sizeof (defaultValue) + sizeof (numberOfValues);
+        size_in_bytes += exceptionPositions.capacity() * sizeof (TID);
+        size_in_bytes += exceptionValues.capacity() * sizeof (T);
+        return size_in_bytes;
+    }
+
+    template<class T>
+    SparseEncoding<T>::Cursor::Cursor(const SparseEncoding<T>& column) : ColumnCursor<T>(column.size()), column(column), exception(0) {
+
+    }
+
+    template<class T>
+    void SparseEncoding<T>::Cursor::decodeNext(TID begin, size_t count, T* out) {
+        const std::vector<TID>& positions = column.exceptionPositions;
+        while (exception < positions.size() && positions[exception] < begin) {
+            exception++;
+        }
+        std::fill(out, out + count, column.defaultValue);
+        for (; exception < positions.size() && positions[exception] < begin + count; exception++) {
+            out[positions[exception] - begin] = column.exceptionValues[exception];
+        }
+    }
+
+    /***************** End of Implementation Section ******************/
+
+
+
+}; //end namespace CogaDB
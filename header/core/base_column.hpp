@@ -89,12 +89,31 @@ namespace CoGaDB {
         /*! \brief joins two columns using the hash join algorithm
          * \return PositionListPairPtr to a PositionListPair, which represents the result*/
         virtual const PositionListPairPtr hash_join(ColumnPtr join_column) = 0;
+        /*! \brief returns the TIDs of all values that have a join partner in join_column, using a bloom filter or bitmap of its values
+         * \return PositionListPtr to a PositionList, which represents the result*/
+        virtual const PositionListPtr semi_join(ColumnPtr join_column) = 0;
         /*! \brief joins two columns using the sort merge join algorithm
          * \return PositionListPairPtr to a PositionListPair, which represents the result*/
         virtual const PositionListPairPtr sort_merge_join(ColumnPtr join_column) = 0;
         /*! \brief joins two columns using the nested loop join algorithm
          * \return PositionListPairPtr to a PositionListPair, which represents the result*/
         virtual const PositionListPairPtr nested_loop_join(ColumnPtr join_column) = 0;
+        /*! \brief joins two columns using the block nested loop join algorithm on the condition 'value comp join value' (=,<,>)
+         * \return PositionListPairPtr to a PositionListPair, which represents the result*/
+        virtual const PositionListPairPtr theta_join(ColumnPtr join_column, const ValueComparator comp) = 0;
+        /*! \brief joins two columns using the block nested loop join algorithm on the condition 'join value - distance <= value <= join value + distance'
+         * \details distance has to have the type of the column values, strings are never joined
+         * \return PositionListPairPtr to a PositionListPair, which represents the result*/
+        virtual const PositionListPairPtr band_join(ColumnPtr join_column, const boost::any& distance) = 0;
+        /*! \brief joins two columns using the given join algorithm, AUTO chooses the algorithm with chooseJoinAlgorithm()
+         * \details the algorithm that was used is recorded and returned by getLastJoinAlgorithm()
+         * \return PositionListPairPtr to a PositionListPair, which represents the result*/
+        const PositionListPairPtr join(ColumnPtr join_column, JoinAlgorithm algorithm = AUTO);
+        /*! \brief chooses a join algorithm from the sizes, the sortedness, the encodings and the number of distinct values of both columns
+         * \return SORT_MERGE_JOIN, NESTED_LOOP_JOIN or HASH_JOIN*/
+        virtual JoinAlgorithm chooseJoinAlgorithm(ColumnPtr join_column) = 0;
+        /*! \brief returns the algorithm used by the last call of join(), AUTO if join() was not called yet*/
+        JoinAlgorithm getLastJoinAlgorithm() const throw ();
         /***************** column algebra operations *****************/
         /*! \brief adds constant to column
          *  \details for all indeces i holds the following property: B[i]=A[i]+new_Value*/
@@ -148,6 +167,8 @@ namespace CoGaDB {
         std::string name_;
         /*! \brief database type of the column*/
         AttributeType db_type_;
+        /*! \brief join algorithm used by the last call of join()*/
+        JoinAlgorithm last_join_algorithm_;
         //	Table& table_;
     };
 
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <core/column_base_typed.hpp>
+#include <stdint.h>
+
+namespace CoGaDB {
+
+    /* \brief a Bitmap is an STL vector of 64 bit words, bit i of word j stands for the TID j*64+i*/
+    typedef std::vector<uint64_t> Bitmap;
+    /* \brief a BitmapPtr is a a references counted smart pointer to a Bitmap object*/
+    typedef shared_pointer_namespace::shared_ptr<Bitmap> BitmapPtr;
+
+    /*!
+     *  \brief     This class represents a column of boolean values, which stores one bit per value.
+     *  \details   The values are packed into 64 bit words, all bits behind the last value are zero. Counting is a popcount over
+     *             the words and selections produce a bitmap with one word operation per 64 values. Since the values are packed,
+     *             operator[] returns a reference to a copy of the value, writes have to use update().
+     */
+    class BooleanColumn : public ColumnBaseTyped<bool> {
+    public:
+        /***************** constructors and destructor *****************/
+        BooleanColumn(const std::string& name, AttributeType db_type);
+        virtual ~BooleanColumn();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const bool& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief extracts the bits of the range*/
+        virtual void decode(TID begin, size_t count, bool* out);
+
+        /*! \brief returns the TIDs of all values matching the predicate, computed from the selection bitmap*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+        /*! \brief returns a bitmap with a set bit for every value matching the predicate*/
+        const BitmapPtr selectionBitmap(bool value_for_comparison, const ValueComparator comp) const;
+
+        /*! \brief returns the number of values that are true*/
+        size_t count() const throw ();
+        /*! \brief returns the number of values that are equal to value*/
+        size_t count(bool value) const throw ();
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+        virtual bool isMaterialized() const throw ();
+        virtual bool isCompressed() const throw ();
+
+        virtual bool& operator[](const int index);
+
+    private:
+
+        bool getValue(TID tid) const;
+        void setValue(TID tid, bool value);
+
+        /*vector<[64_PACKED_VALUES]>*/
+        std::vector<uint64_t> words;
+        uint64_t numberOfValues;
+
+    };
+
+    template <typename InputIterator>
+    bool BooleanColumn::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(bool(*it)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}; //end namespace CogaDB
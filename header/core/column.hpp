@@ -26,6 +26,8 @@ namespace CoGaDB {
         //assumes tid list is sorted ascending
         virtual bool remove(PositionListPtr tid);
         virtual bool clearContent();
+        /*! \brief swaps the values into the column*/
+        virtual bool replaceContent(std::vector<T>& values);
 
         virtual const boost::any get(TID tid);
         //virtual const boost::any* const getRawData();
@@ -35,6 +37,10 @@ namespace CoGaDB {
 
         virtual const ColumnPtr copy() const;
 
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief reads the values of the TIDs directly and prefetches the values of unsorted lists*/
+        virtual void gather(const PositionList& tids, T* out);
+
         virtual bool store(const std::string& path);
         virtual bool load(const std::string& path);
         virtual bool isMaterialized() const throw ();
@@ -176,6 +182,12 @@ namespace CoGaDB {
         return true;
     }
 
+    template<class T>
+    bool Column<T>::replaceContent(std::vector<T>& values) {
+        values_.swap(values);
+        return true;
+    }
+
     template<class T>
     const boost::any Column<T>::get(TID tid) {
         if (tid < values_.size())
@@ -204,6 +216,23 @@ namespace CoGaDB {
     const ColumnPtr Column<T>::copy() const {
         return ColumnPtr(new Column<T>(*this));
     }
+
+    template<class T>
+    void Column<T>::decode(TID begin, size_t count, T* out) {
+        std::copy(values_.begin() + begin, values_.begin() + begin + count, out);
+    }
+
+    template<class T>
+    void Column<T>::gather(const PositionList& tids, T* out) {
+        //random TIDs miss the cache on nearly every value, so the value GATHER_PREFETCH_DISTANCE positions ahead is requested early
+        for (size_t i = 0; i < tids.size(); i++) {
+            if (i + GATHER_PREFETCH_DISTANCE < tids.size()) {
+                __builtin_prefetch(&values_[tids[i + GATHER_PREFETCH_DISTANCE]]);
+            }
+            out[i] = values_[tids[i]];
+        }
+    }
+
     /***************** relational operations on Columns which return lookup tables *****************/
     //	template<class T>
     //	const std::vector<TID> Column<T>::sort(const ComputeDevice comp_dev) const {
@@ -2,20 +2,46 @@
 #pragma once
 
 #include <core/base_column.hpp>
+#include <core/column_cursor.hpp>
+#include <core/selection_kernels.hpp>
+#include <core/thread_pool.hpp>
+#include <core/sort_kernels.hpp>
+#include <core/join_kernels.hpp>
+#include <core/join_filter.hpp>
+#include <core/column_expression.hpp>
 #include <iostream>
 
 #include <utility>
 #include <functional>
 #include <algorithm>
+#include <cmath>
 
-#include <boost/unordered_map.hpp>
 #include <boost/any.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/bind/bind.hpp>
 
 //#include <core/column.hpp>
 
 /*! \brief The global namespace of the programming tasks, to avoid name claches with other libraries.*/
 namespace CoGaDB {
 
+    /*! \brief number of values the generic operators decode at once, small enough to keep a batch in the L1/L2 cache*/
+    const size_t DECODE_BATCH_SIZE = 2048;
+    /*! \brief number of values a gather requests from memory ahead of the value it reads*/
+    const size_t GATHER_PREFETCH_DISTANCE = 16;
+    /*! \brief chunks of parallel scans start at multiples of this number of TIDs, a multiple of the bitmap word and of all block sizes*/
+    const TID CHUNK_ALIGNMENT = 128;
+
+    /*! \brief returns true, if the TIDs of the list are sorted ascending (equal neighbours are allowed)*/
+    inline bool isSortedAscending(const PositionList& tids) {
+        for (size_t i = 1; i < tids.size(); i++) {
+            if (tids[i] < tids[i - 1]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /*!
      * 
      * 
@@ -32,6 +58,8 @@ namespace CoGaDB {
     template<class T>
     class ColumnBaseTyped : public ColumnBase {
     public:
+        /*! \brief a ColumnCursorPtr is a reference counted smart pointer to a cursor over a column of type T*/
+        typedef shared_pointer_namespace::shared_ptr<ColumnCursor<T> > ColumnCursorPtr;
         //typedef boost::shared_ptr<ColumnBaseTyped> ColumnPtr;
         /***************** constructors and destructor *****************/
         ColumnBaseTyped(const std::string& name, AttributeType db_type);
@@ -54,14 +82,94 @@ namespace CoGaDB {
         virtual unsigned int getSizeinBytes() const throw () = 0;
 
         virtual const ColumnPtr copy() const = 0;
+        /*! \brief writes the values with the TIDs [begin, begin+count) to out, which has to have room for count values
+         * \details The default implementation calls operator[] once per value, encodings override it with a sequential decoder.
+         * All generic operators read the column through this method in batches of DECODE_BATCH_SIZE values.
+         * */
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief returns a cursor, which streams over all values of the column in TID order
+         * \details The default cursor reads batches with decode(), encodings whose decode() has to search for the start of a batch
+         * return a cursor that keeps its decoding state instead. The cursor must not outlive the column.
+         * */
+        virtual ColumnCursorPtr createCursor();
+        /*! \brief returns the first TID at or behind tid at which a chunk of a parallel scan may start, at most size()
+         * \details The default rounds up to a multiple of CHUNK_ALIGNMENT, encodings with units of variable length (e.g., runs)
+         * return the start of their next unit instead.
+         * */
+        virtual TID getChunkBoundary(TID tid);
+        /*! \brief writes the values with the TIDs of the list to out, which has to have room for tids.size() values
+         * \details All TIDs have to be valid, the list may contain duplicates. The default implementation reads ascending lists in
+         * one forward pass of a cursor, all other lists are sorted first and their values are scattered back afterwards.
+         * Encodings override it to merge the list with their structures or to prefetch the values of unsorted lists.
+         * */
+        virtual void gather(const PositionList& tids, T* out);
         /***************** relational operations on Columns which return lookup tables *****************/
         virtual const PositionListPtr sort(SortOrder order);
         virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
         virtual const PositionListPtr parallel_selection(const boost::any& value_for_comparison, const ValueComparator comp, unsigned int number_of_threads);
+        /*! \brief returns the TIDs of all values fulfilling the predicate, a functor taking a value of type T and returning bool
+         * \details The column is decoded in batches and every batch is filtered by the branch free kernel selectBatch(), which is
+         * compiled once per predicate type. Use ComparatorPredicate, NotEqualPredicate or BetweenPredicate from selection_kernels.hpp.
+         * If the ParallelizationMode is PARALLEL, all threads of the global ThreadPool are used.
+         * */
+        template<class Predicate>
+        const PositionListPtr typed_selection(const Predicate& predicate);
+        /*! \brief returns the TIDs of all values unequal to value_for_comparison*/
+        const PositionListPtr not_equal_selection(const T& value_for_comparison);
+        /*! \brief returns the TIDs of all values of the closed interval [lower, upper]*/
+        const PositionListPtr between_selection(const T& lower, const T& upper);
+        /*! \brief returns the TIDs of all values fulfilling the predicate, the column is split into CHUNKS_PER_THREAD chunks per thread
+         * \details The chunks are filtered concurrently on the global ThreadPool, each one with its own cursor, so decode() of a
+         * column must not modify it. The TID lists of the chunks are concatenated in chunk order, so the result equals the one of
+         * typed_selection().
+         * */
+        template<class Predicate>
+        const PositionListPtr parallel_typed_selection(const Predicate& predicate, unsigned int number_of_threads);
         //join algorithms
+        /*! \brief radix partitioned hash join, the hash tables are built on the smaller column (see radixHashJoin())
+         * \details If the probe column has at least JOIN_FILTER_MIN_PROBE_RATIO times as many values as the build column, a JoinFilter
+         * of the build values is pushed into the scan of the probe column by filter_selection(). Only the values passing the filter
+         * are gathered and probed, so most values without join partner are dropped at scan speed.
+         * */
         virtual const PositionListPairPtr hash_join(ColumnPtr join_column);
+        /*! \brief returns the ascending TIDs of all values that have a join partner in join_column
+         * \details The scan of this column is filtered by a JoinFilter of the values of join_column. The candidates of a bloom filter
+         * are verified by a hash join, the candidates of an exact filter are the result.
+         * */
+        virtual const PositionListPtr semi_join(ColumnPtr join_column);
+        /*! \brief returns the TIDs of all values the filter may contain, the default filters the decoded batches with a JoinFilterPredicate*/
+        virtual const PositionListPtr filter_selection(const JoinFilter<T>& filter);
         virtual const PositionListPairPtr sort_merge_join(ColumnPtr join_column);
+        /*! \brief block nested loop join with the condition 'value == join value' (see block_nested_loop_join())*/
         virtual const PositionListPairPtr nested_loop_join(ColumnPtr join_column);
+        virtual const PositionListPairPtr theta_join(ColumnPtr join_column, const ValueComparator comp);
+        virtual const PositionListPairPtr band_join(ColumnPtr join_column, const boost::any& distance);
+        /*! \brief joins this column as outer column with join_column as inner column on a condition, e.g., ComparatorCondition or BandCondition from join_kernels.hpp
+         * \details The inner column is decoded once and the outer column in tiles of DECODE_BATCH_SIZE values. Every outer tile is
+         * joined with every inner tile of the same size by joinTiles(), so both tiles stay in the cache. If the ParallelizationMode is
+         * PARALLEL, chunks of outer tiles are joined concurrently. The pairs are ordered by outer tile, inner TID and outer TID in both modes.
+         * */
+        template<class Condition>
+        const PositionListPairPtr block_nested_loop_join(ColumnBaseTyped<T>& join_column, const Condition& condition);
+        /*! \brief chooses the join algorithm in this order:
+         * \details - the algorithm of a join in the compressed domain, if hasCompressedJoin() provides one
+         * - NESTED_LOOP_JOIN, if one column has at most NESTED_LOOP_JOIN_MAX_SIZE values
+         * - SORT_MERGE_JOIN, if both columns are sorted
+         * - NESTED_LOOP_JOIN, if both columns have at most NESTED_LOOP_JOIN_MAX_DISTINCT_VALUES distinct values, so writing the result dominates
+         * - HASH_JOIN otherwise
+         * */
+        virtual JoinAlgorithm chooseJoinAlgorithm(ColumnPtr join_column);
+        /*! \brief returns true and sets algorithm, if this encoding joins with join_column without decoding their values
+         * \details the join method of algorithm implements the compressed join, by default no compressed join exists
+         * */
+        virtual bool hasCompressedJoin(ColumnBaseTyped<T>& join_column, JoinAlgorithm& algorithm);
+        /*! \brief returns true, if the values are sorted ascending, the default scans the values until the first unsorted pair*/
+        virtual bool isSorted();
+        /*! \brief returns an estimate of the number of distinct values
+         * \details The default estimates it from an evenly spaced sample of DISTINCT_VALUES_SAMPLE_SIZE values with the GEE estimator:
+         * values that occur once in the sample are scaled by sqrt(size / sample size), all other values of the sample are counted once.
+         * */
+        virtual size_t getNumberOfDistinctValues();
 
 
         virtual bool add(const boost::any& new_Value);
@@ -76,6 +184,24 @@ namespace CoGaDB {
 
         virtual bool division(const boost::any& new_Value);
         virtual bool division(ColumnPtr join_column);
+        /*! \brief applies 'value operation constant' to all values without decoding them and returns true
+         * \details Encodings override it to transform each distinct value or run once. The default returns false, so add(), minus(),
+         * multiply() and division() with a constant evaluate an expression over the decoded values instead (see assign()).
+         * */
+        virtual bool transformValues(ArithmeticOperation operation, const T& constant);
+        /*! \brief replaces the values of this column by the values of an expression, e.g., (operand(a) + operand(b)) * operand(c) - 1
+         * \details The expression is fused into one pass (see column_expression.hpp): every batch of DECODE_BATCH_SIZE rows is decoded from
+         * all operand columns and the whole expression is computed for it, so no intermediate column is written. If the ParallelizationMode
+         * is PARALLEL, chunks of batches are evaluated concurrently, each by its own copy of the expression. The expression may reference
+         * this column, since the values are replaced by replaceContent() after the evaluation. Empty columns of any encoding receive the
+         * values of an expression as well. The result has the size of the smallest operand column.
+         * */
+        template<class Expression>
+        bool assign(const ColumnExpression<Expression>& expression);
+        /*! \brief replaces all values of the column by values, which may be swapped into the column
+         * \details the default clears the column and inserts the values one by one
+         * */
+        virtual bool replaceContent(std::vector<T>& values);
 
         //template <typename U, typename BinaryOperator>
         //std::pair<ColumnPtr,ColumnPtr> aggregate_by_keys(ColumnBaseTyped<U>* keys, BinaryOperator binary_op) const;
@@ -92,6 +218,31 @@ namespace CoGaDB {
          * */
         virtual T& operator[](const int index) = 0;
         inline bool operator==(ColumnBaseTyped<T>& column);
+
+    private:
+        //splits the column into at most numberOfChunks chunks of at least one batch at boundaries of getChunkBoundary(),
+        //chunk i is [chunkBegins[i], chunkBegins[i+1])
+        void getChunks(size_t numberOfChunks, std::vector<TID>& chunkBegins);
+        //writes the TIDs of the values in [begin, end) that fulfill the predicate to result
+        template<class Predicate>
+        void selectChunk(const Predicate* predicate, TID begin, TID end, PositionList* result);
+        //writes the values in [begin, end) to out
+        void decodeChunk(TID begin, TID end, T* out);
+        //writes all values to out, in concurrent chunks if pool is not NULL
+        void decodeColumn(T* out, ThreadPool* pool);
+        //returns the TIDs in the order of ascending values and the values in this order
+        void getSortedValues(PositionList& positions, T* out);
+        //writes the values of the expression for the rows [begin, end) to out, the expression is copied, so every chunk decodes into its own batches
+        template<class Expression>
+        static void evaluateChunk(Expression expression, TID begin, TID end, T* out);
+        //joins the outer tiles in [begin, end) with all inner values, begin is a multiple of DECODE_BATCH_SIZE
+        template<class Condition>
+        void joinOuterChunk(const T* innerValues, size_t numberOfInnerValues, const Condition* condition, TID begin, TID end, PositionListPair* result);
+        //concatenates the lists in order, with a pool the lists are copied concurrently to their ranges of the result
+        static void concatenateChunks(const std::vector<const PositionList*>& chunks, PositionList& result, ThreadPool* pool);
+        static void copyChunk(const PositionList* chunk, TID* target);
+        //replaces every position by the TID it has in candidates
+        static void mapPositions(const PositionList* candidates, PositionList* positions);
     };
 
     template<class T>
@@ -110,44 +261,145 @@ namespace CoGaDB {
     }
 
     template<class T>
-    const PositionListPtr ColumnBaseTyped<T>::sort(SortOrder order) {
+    void ColumnBaseTyped<T>::decode(TID begin, size_t count, T* out) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = (*this)[begin + i];
+        }
+    }
 
-        PositionListPtr ids = PositionListPtr(new PositionList());
-        std::vector<std::pair<T, TID> > v;
+    template<class T>
+    typename ColumnBaseTyped<T>::ColumnCursorPtr ColumnBaseTyped<T>::createCursor() {
+        return ColumnCursorPtr(new DecodeCursor<T>(*this));
+    }
+
+    template<class T>
+    TID ColumnBaseTyped<T>::getChunkBoundary(TID tid) {
+        TID boundary = (tid + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+        return std::min(boundary, (TID) this->size());
+    }
+
+    template<class T>
+    void ColumnBaseTyped<T>::getChunks(size_t numberOfChunks, std::vector<TID>& chunkBegins) {
+        numberOfChunks = std::max((size_t) 1, std::min(numberOfChunks, this->size() / DECODE_BATCH_SIZE));
+        chunkBegins.assign(numberOfChunks + 1, 0);
+        for (size_t i = 1; i < numberOfChunks; i++) {
+            chunkBegins[i] = std::max(chunkBegins[i - 1], this->getChunkBoundary((TID) ((uint64_t) this->size() * i / numberOfChunks)));
+        }
+        chunkBegins[numberOfChunks] = this->size();
+    }
 
-        for (unsigned int i = 0; i<this->size(); i++) {
-            v.push_back(std::pair<T, TID>((*this)[i], i));
+    template<class T>
+    void ColumnBaseTyped<T>::decodeChunk(TID begin, TID end, T* out) {
+        ColumnCursorPtr cursor = this->createCursor();
+        cursor->skipTo(begin);
+        cursor->nextBatch(out, end - begin);
+    }
+
+    template<class T>
+    void ColumnBaseTyped<T>::decodeColumn(T* out, ThreadPool* pool) {
+        if (pool == NULL) {
+            this->decodeChunk(0, this->size(), out);
+            return;
+        }
+        std::vector<TID> chunkBegins;
+        this->getChunks(pool->getNumberOfThreads() * CHUNKS_PER_THREAD, chunkBegins);
+        std::vector<ThreadPool::Task> tasks;
+        for (size_t i = 0; i + 1 < chunkBegins.size(); i++) {
+            tasks.push_back(boost::bind(&ColumnBaseTyped<T>::decodeChunk, this, chunkBegins[i], chunkBegins[i + 1], out + chunkBegins[i]));
         }
+        pool->execute(tasks);
+    }
 
-        //TODO: change implementation, so that no copy operations are required -> use boost zip iterators!
+    template<class T>
+    void ColumnBaseTyped<T>::concatenateChunks(const std::vector<const PositionList*>& chunks, PositionList& result, ThreadPool* pool) {
+        size_t numberOfResults = 0;
+        for (size_t i = 0; i < chunks.size(); i++) {
+            numberOfResults += chunks[i]->size();
+        }
+        result.resize(numberOfResults);
+
+        std::vector<ThreadPool::Task> tasks;
+        size_t offset = 0;
+        for (size_t i = 0; i < chunks.size(); i++) {
+            if (!chunks[i]->empty()) {
+                if (pool == NULL) {
+                    copyChunk(chunks[i], &result[offset]);
+                } else {
+                    tasks.push_back(boost::bind(&ColumnBaseTyped<T>::copyChunk, chunks[i], &result[offset]));
+                }
+            }
+            offset += chunks[i]->size();
+        }
+        if (pool != NULL) {
+            pool->execute(tasks);
+        }
+    }
 
-        if (order == ASCENDING) {
-            //tbb::parallel_sort(v.begin(),v.end(),std::less_equal<std::pair<T,TID> >());
-            std::stable_sort(v.begin(), v.end(), std::less_equal<std::pair<T, TID> >());
-        } else if (order == DESCENDING) {
-            //tbb::parallel_sort(v.begin(),v.end(),std::greater_equal<std::pair<T,TID> >());
-            std::stable_sort(v.begin(), v.end(), std::greater_equal<std::pair<T, TID> >());
-        } else {
-            std::cout << "FATAL ERROR: ColumnBaseTyped<T>::sort(): Unknown Sorting Order!" << std::endl;
+    template<class T>
+    void ColumnBaseTyped<T>::gather(const PositionList& tids, T* out) {
+        if (tids.empty()) {
+            return;
+        }
+        if (isSortedAscending(tids)) {
+            ColumnCursorPtr cursor = this->createCursor();
+            //end of the batch the cursor has decoded, a TID behind it makes the cursor decode the batch starting at the TID
+            TID decodedEnd = 0;
+            for (size_t i = 0; i < tids.size(); i++) {
+                //a cursor never moves backwards, so a repeated TID copies the previous value
+                if (i > 0 && tids[i] == tids[i - 1]) {
+                    out[i] = out[i - 1];
+                } else if (tids[i] < decodedEnd || (i + 1 < tids.size() && tids[i + 1] - tids[i] < CURSOR_BATCH_SIZE)) {
+                    if (tids[i] >= decodedEnd) {
+                        decodedEnd = (TID) std::min(tids[i] + CURSOR_BATCH_SIZE, (size_t) this->size());
+                    }
+                    cursor->skipTo(tids[i]);
+                    out[i] = cursor->next();
+                } else {
+                    //no other TID falls into the batch the cursor would decode, so the value is decoded alone
+                    this->decode(tids[i], 1, &out[i]);
+                }
+            }
+            return;
         }
 
-        for (unsigned int i = 0; i < v.size(); i++) {
-            ids->push_back(v[i].second);
+        //vector<[TID, POSITION_IN_LIST]>, sorted by TID
+        std::vector<std::pair<TID, TID> > order(tids.size());
+        for (TID i = 0; i < tids.size(); i++) {
+            order[i] = std::pair<TID, TID>(tids[i], i);
+        }
+        std::sort(order.begin(), order.end());
+        PositionList sortedTids(tids.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            sortedTids[i] = order[i].first;
         }
 
-        return ids;
+        boost::scoped_array<T> values(new T[tids.size()]);
+        this->gather(sortedTids, values.get());
+        for (size_t i = 0; i < order.size(); i++) {
+            out[order[i].second] = values[i];
+        }
     }
 
     template<class T>
-    const PositionListPtr ColumnBaseTyped<T>::parallel_selection(const boost::any&, const ValueComparator, unsigned int) {
+    const PositionListPtr ColumnBaseTyped<T>::sort(SortOrder order) {
 
-        PositionListPtr result_tids(new PositionList());
+        PositionListPtr ids = PositionListPtr(new PositionList());
+        if (order != ASCENDING && order != DESCENDING) {
+            std::cout << "FATAL ERROR: ColumnBaseTyped<T>::sort(): Unknown Sorting Order!" << std::endl;
+            return ids;
+        }
 
-        return result_tids;
+        //the values are decoded once into one array, only the TIDs are moved by the sort
+        boost::scoped_array<T> values(new T[this->size()]);
+        ThreadPool* pool = getParallelizationMode() == PARALLEL ? &ThreadPool::getGlobalThreadPool() : NULL;
+        this->decodeColumn(values.get(), pool);
+
+        sortPositions(values.get(), this->size(), order, *ids, pool);
+        return ids;
     }
 
     template<class T>
-    const PositionListPtr ColumnBaseTyped<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+    const PositionListPtr ColumnBaseTyped<T>::parallel_selection(const boost::any& value_for_comparison, const ValueComparator comp, unsigned int number_of_threads) {
         if (value_for_comparison.type() != typeid (T)) {
             std::cout << "Fatal Error!!! Typemismatch for column " << name_ << std::endl;
             std::cout << "File: " << __FILE__ << " Line: " << __LINE__ << std::endl;
@@ -156,45 +408,138 @@ namespace CoGaDB {
 
         T value = boost::any_cast<T>(value_for_comparison);
 
+        //prefix and substring predicates only apply to strings
+        if ((comp == PREFIX || comp == SUBSTRING) && typeid (T) != typeid (std::string)) {
+            return PositionListPtr(new PositionList());
+        }
+
+        if (comp == EQUAL) {
+            return this->parallel_typed_selection(ComparatorPredicate<T, EQUAL>(value), number_of_threads);
+        } else if (comp == LESSER) {
+            return this->parallel_typed_selection(ComparatorPredicate<T, LESSER>(value), number_of_threads);
+        } else if (comp == GREATER) {
+            return this->parallel_typed_selection(ComparatorPredicate<T, GREATER>(value), number_of_threads);
+        } else if (comp == PREFIX) {
+            return this->parallel_typed_selection(ComparatorPredicate<T, PREFIX>(value), number_of_threads);
+        } else if (comp == SUBSTRING) {
+            return this->parallel_typed_selection(ComparatorPredicate<T, SUBSTRING>(value), number_of_threads);
+        }
+        return PositionListPtr(new PositionList());
+    }
+
+    template<class T>
+    template<class Predicate>
+    const PositionListPtr ColumnBaseTyped<T>::parallel_typed_selection(const Predicate& predicate, unsigned int number_of_threads) {
+        PositionListPtr result_tids(new PositionList());
+        //every chunk holds at least one batch, smaller columns are filtered by the calling thread
+        std::vector<TID> chunkBegins;
+        this->getChunks((size_t) number_of_threads * CHUNKS_PER_THREAD, chunkBegins);
+        if (number_of_threads <= 1 || chunkBegins.size() <= 2) {
+            this->selectChunk(&predicate, 0, this->size(), result_tids.get());
+            return result_tids;
+        }
 
-        PositionListPtr result_tids;
+        size_t numberOfChunks = chunkBegins.size() - 1;
+        std::vector<PositionList> chunkResults(numberOfChunks);
+        std::vector<ThreadPool::Task> tasks;
+        for (size_t i = 0; i < numberOfChunks; i++) {
+            tasks.push_back(boost::bind(&ColumnBaseTyped<T>::selectChunk<Predicate>, this, &predicate, chunkBegins[i], chunkBegins[i + 1], &chunkResults[i]));
+        }
+        ThreadPool::getGlobalThreadPool().execute(tasks);
 
-        result_tids = PositionListPtr(new PositionList());
+        //every chunk is copied to its own range of the result, so the threads do not need a lock
+        std::vector<const PositionList*> chunks;
+        for (size_t i = 0; i < numberOfChunks; i++) {
+            chunks.push_back(&chunkResults[i]);
+        }
+        concatenateChunks(chunks, *result_tids, &ThreadPool::getGlobalThreadPool());
+        return result_tids;
+    }
 
-        if (!quiet) std::cout << "Using CPU for Selection..." << std::endl;
-        for (TID i = 0; i<this->size(); i++) {
+    template<class T>
+    template<class Predicate>
+    void ColumnBaseTyped<T>::selectChunk(const Predicate* predicate, TID begin, TID end, PositionList* result) {
+        ColumnCursorPtr cursor = this->createCursor();
+        cursor->skipTo(begin);
+
+        boost::scoped_array<T> values(new T[DECODE_BATCH_SIZE]);
+        for (TID batchBegin = begin; batchBegin < end; batchBegin += DECODE_BATCH_SIZE) {
+            size_t count = std::min((size_t) DECODE_BATCH_SIZE, (size_t) (end - batchBegin));
+            cursor->nextBatch(values.get(), count);
+
+            size_t numberOfResults = result->size();
+            result->resize(numberOfResults + count);
+            size_t numberOfMatches = selectBatch(values.get(), count, batchBegin, *predicate, &(*result)[numberOfResults]);
+            result->resize(numberOfResults + numberOfMatches);
+        }
+    }
 
-            //boost::any value = column->get(i);
-            //val = values_[i];
+    template<class T>
+    void ColumnBaseTyped<T>::copyChunk(const PositionList* chunk, TID* target) {
+        std::copy(chunk->begin(), chunk->end(), target);
+    }
 
-            if (comp == EQUAL) {
-                if (value == (*this)[i]) {
-                    //result_table->insert(this->fetchTuple(i));
-                    result_tids->push_back(i);
-                }
-            } else if (comp == LESSER) {
-                if ((*this)[i] < value) {
-                    //result_table->insert(this->fetchTuple(i));
-                    result_tids->push_back(i);
-                }
-            } else if (comp == GREATER) {
-                if ((*this)[i] > value) {
-                    result_tids->push_back(i);
-                    //result_table->insert(this->fetchTuple(i));
-                }
-            } else {
+    template<class T>
+    void ColumnBaseTyped<T>::mapPositions(const PositionList* candidates, PositionList* positions) {
+        for (size_t i = 0; i < positions->size(); i++) {
+            (*positions)[i] = (*candidates)[(*positions)[i]];
+        }
+    }
 
-            }
+    template<class T>
+    const PositionListPtr ColumnBaseTyped<T>::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (T)) {
+            std::cout << "Fatal Error!!! Typemismatch for column " << name_ << std::endl;
+            std::cout << "File: " << __FILE__ << " Line: " << __LINE__ << std::endl;
+            exit(-1);
+        }
+
+        T value = boost::any_cast<T>(value_for_comparison);
+
+        //prefix and substring predicates only apply to strings
+        if ((comp == PREFIX || comp == SUBSTRING) && typeid (T) != typeid (std::string)) {
+            return PositionListPtr(new PositionList());
+        }
+
+        if (!quiet) std::cout << "Using CPU for Selection..." << std::endl;
+        //the comparator is resolved once here, every kernel is specialized for its comparator
+        if (comp == EQUAL) {
+            return this->typed_selection(ComparatorPredicate<T, EQUAL>(value));
+        } else if (comp == LESSER) {
+            return this->typed_selection(ComparatorPredicate<T, LESSER>(value));
+        } else if (comp == GREATER) {
+            return this->typed_selection(ComparatorPredicate<T, GREATER>(value));
+        } else if (comp == PREFIX) {
+            return this->typed_selection(ComparatorPredicate<T, PREFIX>(value));
+        } else if (comp == SUBSTRING) {
+            return this->typed_selection(ComparatorPredicate<T, SUBSTRING>(value));
         }
+        return PositionListPtr(new PositionList());
+    }
 
-        //}
+    template<class T>
+    template<class Predicate>
+    const PositionListPtr ColumnBaseTyped<T>::typed_selection(const Predicate& predicate) {
+        if (getParallelizationMode() == PARALLEL) {
+            return this->parallel_typed_selection(predicate, ThreadPool::getGlobalThreadPool().getNumberOfThreads());
+        }
+        PositionListPtr result_tids(new PositionList());
+        this->selectChunk(&predicate, 0, this->size(), result_tids.get());
         return result_tids;
     }
 
     template<class T>
-    const PositionListPairPtr ColumnBaseTyped<T>::hash_join(ColumnPtr join_column_) {
+    const PositionListPtr ColumnBaseTyped<T>::not_equal_selection(const T& value_for_comparison) {
+        return this->typed_selection(NotEqualPredicate<T>(value_for_comparison));
+    }
+
+    template<class T>
+    const PositionListPtr ColumnBaseTyped<T>::between_selection(const T& lower, const T& upper) {
+        return this->typed_selection(BetweenPredicate<T>(lower, upper));
+    }
 
-        typedef boost::unordered_multimap<T, TID, boost::hash<T>, std::equal_to<T> > HashTable;
+    template<class T>
+    const PositionListPairPtr ColumnBaseTyped<T>::hash_join(ColumnPtr join_column_) {
 
         if (join_column_->type() != typeid (T)) {
             std::cout << "Fatal Error!!! Typemismatch for columns " << this->name_ << " and " << join_column_->getName() << std::endl;
@@ -208,29 +553,104 @@ namespace CoGaDB {
         join_tids->first = PositionListPtr(new PositionList());
         join_tids->second = PositionListPtr(new PositionList());
 
+        //the hash tables are built on the smaller column, the larger one probes them
+        ThreadPool* pool = getParallelizationMode() == PARALLEL ? &ThreadPool::getGlobalThreadPool() : NULL;
+        bool buildOnThis = this->size() <= join_column->size();
+        ColumnBaseTyped<T>& build = buildOnThis ? *this : *join_column;
+        ColumnBaseTyped<T>& probe = buildOnThis ? *join_column : *this;
+        boost::scoped_array<T> buildValues(new T[build.size()]);
+        build.decodeColumn(buildValues.get(), pool);
+
+        //a much larger probe column is filtered by the build values in its scan, only the candidates are gathered and probed
+        PositionListPtr candidates;
+        boost::scoped_array<T> probeValues;
+        size_t probeSize = probe.size();
+        if (build.size() > 0 && probe.size() >= JOIN_FILTER_MIN_PROBE_RATIO * build.size()) {
+            JoinFilter<T> filter(buildValues.get(), build.size());
+            candidates = probe.filter_selection(filter);
+            probeSize = candidates->size();
+            probeValues.reset(new T[probeSize]);
+            probe.gather(*candidates, probeValues.get());
+        } else {
+            probeValues.reset(new T[probeSize]);
+            probe.decodeColumn(probeValues.get(), pool);
+        }
 
-        //create hash table
-        HashTable hashtable;
-        for (unsigned int i = 0; i<this->size(); i++)
-            hashtable.insert(
-                std::pair<T, TID> ((*this)[i], i)
-                );
-
-        //probe larger relation
-        for (unsigned int i = 0; i < join_column->size(); i++) {
-            std::pair<typename HashTable::iterator, typename HashTable::iterator> range = hashtable.equal_range((*join_column)[i]);
-            for (typename HashTable::iterator it = range.first; it != range.second; it++) {
-                if (it->first == (*join_column)[i]) {
-                    join_tids->first->push_back(it->second);
-                    join_tids->second->push_back(i);
-                    //cout << "match! " << it->second << ", " << i << "	"  << it->first << endl;
+        std::vector<PositionListPair> results;
+        radixHashJoin(buildValues.get(), build.size(), probeValues.get(), probeSize, results, pool);
+        if (candidates) {
+            //the candidates are ascending, so the probe TIDs keep the order of the unfiltered join
+            std::vector<ThreadPool::Task> tasks;
+            for (size_t i = 0; i < results.size(); i++) {
+                if (pool == NULL) {
+                    mapPositions(candidates.get(), results[i].second.get());
+                } else {
+                    tasks.push_back(boost::bind(&ColumnBaseTyped<T>::mapPositions, candidates.get(), results[i].second.get()));
                 }
             }
+            if (pool != NULL) {
+                pool->execute(tasks);
+            }
         }
 
+        std::vector<const PositionList*> firstChunks;
+        std::vector<const PositionList*> secondChunks;
+        for (size_t i = 0; i < results.size(); i++) {
+            firstChunks.push_back(buildOnThis ? results[i].first.get() : results[i].second.get());
+            secondChunks.push_back(buildOnThis ? results[i].second.get() : results[i].first.get());
+        }
+        concatenateChunks(firstChunks, *join_tids->first, pool);
+        concatenateChunks(secondChunks, *join_tids->second, pool);
         return join_tids;
     }
 
+    template<class T>
+    const PositionListPtr ColumnBaseTyped<T>::semi_join(ColumnPtr join_column_) {
+
+        if (join_column_->type() != typeid (T)) {
+            std::cout << "Fatal Error!!! Typemismatch for columns " << this->name_ << " and " << join_column_->getName() << std::endl;
+            std::cout << "File: " << __FILE__ << " Line: " << __LINE__ << std::endl;
+            exit(-1);
+        }
+
+        shared_pointer_namespace::shared_ptr<ColumnBaseTyped<T> > join_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<T> >(join_column_);
+
+        ThreadPool* pool = getParallelizationMode() == PARALLEL ? &ThreadPool::getGlobalThreadPool() : NULL;
+        boost::scoped_array<T> joinValues(new T[join_column->size()]);
+        join_column->decodeColumn(joinValues.get(), pool);
+        JoinFilter<T> filter(joinValues.get(), join_column->size());
+        PositionListPtr candidates = this->filter_selection(filter);
+        if (filter.isExact() || candidates->empty()) {
+            return candidates;
+        }
+
+        //the false positives of the bloom filter are removed by joining the candidates with the values of join_column
+        boost::scoped_array<T> values(new T[candidates->size()]);
+        this->gather(*candidates, values.get());
+        std::vector<PositionListPair> results;
+        radixHashJoin(joinValues.get(), join_column->size(), values.get(), candidates->size(), results, pool);
+        std::vector<char> hasPartner(candidates->size(), 0);
+        for (size_t i = 0; i < results.size(); i++) {
+            for (size_t j = 0; j < results[i].second->size(); j++) {
+                hasPartner[(*results[i].second)[j]] = 1;
+            }
+        }
+
+        PositionListPtr result_tids(new PositionList(candidates->size()));
+        size_t numberOfResults = 0;
+        for (size_t i = 0; i < candidates->size(); i++) {
+            (*result_tids)[numberOfResults] = (*candidates)[i];
+            numberOfResults += hasPartner[i];
+        }
+        result_tids->resize(numberOfResults);
+        return result_tids;
+    }
+
+    template<class T>
+    const PositionListPtr ColumnBaseTyped<T>::filter_selection(const JoinFilter<T>& filter) {
+        return this->typed_selection(JoinFilterPredicate<T>(filter));
+    }
+
     template<class Type>
     const PositionListPairPtr ColumnBaseTyped<Type>::sort_merge_join(ColumnPtr join_column_) {
 
@@ -246,97 +666,332 @@ namespace CoGaDB {
         join_tids->first = PositionListPtr(new PositionList());
         join_tids->second = PositionListPtr(new PositionList());
 
+        //both columns are sorted by their encodings, their values are gathered in sorted order and merged
+        PositionList positions;
+        PositionList joinPositions;
+        boost::scoped_array<Type> values(new Type[this->size()]);
+        boost::scoped_array<Type> joinValues(new Type[join_column->size()]);
+        this->getSortedValues(positions, values.get());
+        join_column->getSortedValues(joinPositions, joinValues.get());
+        mergeJoin(values.get(), positions, joinValues.get(), joinPositions, *join_tids);
         return join_tids;
     }
 
+    template<class T>
+    void ColumnBaseTyped<T>::getSortedValues(PositionList& positions, T* out) {
+        //sorted columns are decoded as they are
+        if (this->isSorted()) {
+            positions.resize(this->size());
+            for (TID i = 0; i < this->size(); i++) {
+                positions[i] = i;
+            }
+            this->decodeColumn(out, getParallelizationMode() == PARALLEL ? &ThreadPool::getGlobalThreadPool() : NULL);
+            return;
+        }
+        positions = *this->sort(ASCENDING);
+        this->gather(positions, out);
+    }
+
+    template<class T>
+    JoinAlgorithm ColumnBaseTyped<T>::chooseJoinAlgorithm(ColumnPtr join_column_) {
+        //the join reports columns of different types
+        if (join_column_->type() != typeid (T)) {
+            return HASH_JOIN;
+        }
+        shared_pointer_namespace::shared_ptr<ColumnBaseTyped<T> > join_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<T> >(join_column_);
+
+        JoinAlgorithm algorithm;
+        if (this->hasCompressedJoin(*join_column, algorithm)) {
+            return algorithm;
+        }
+        //every value of the other column is compared with a tiny column faster than the other column is partitioned or sorted
+        if (std::min(this->size(), join_column->size()) <= NESTED_LOOP_JOIN_MAX_SIZE) {
+            return NESTED_LOOP_JOIN;
+        }
+        //the checks stop at the first unsorted pair of values, which unsorted columns usually reach early
+        if (this->isSorted() && join_column->isSorted()) {
+            return SORT_MERGE_JOIN;
+        }
+        if (std::max(this->getNumberOfDistinctValues(), join_column->getNumberOfDistinctValues()) <= NESTED_LOOP_JOIN_MAX_DISTINCT_VALUES) {
+            return NESTED_LOOP_JOIN;
+        }
+        return HASH_JOIN;
+    }
+
+    template<class T>
+    bool ColumnBaseTyped<T>::hasCompressedJoin(ColumnBaseTyped<T>&, JoinAlgorithm&) {
+        return false;
+    }
+
+    template<class T>
+    bool ColumnBaseTyped<T>::isSorted() {
+        ColumnCursorPtr cursor = this->createCursor();
+        boost::scoped_array<T> values(new T[DECODE_BATCH_SIZE]);
+        T previous = T();
+        for (TID begin = 0; begin<this->size(); begin += DECODE_BATCH_SIZE) {
+            size_t count = std::min((size_t) DECODE_BATCH_SIZE, this->size() - begin);
+            cursor->nextBatch(values.get(), count);
+            if (begin > 0 && values[0] < previous) {
+                return false;
+            }
+            for (size_t i = 1; i < count; i++) {
+                if (values[i] < values[i - 1]) {
+                    return false;
+                }
+            }
+            previous = values[count - 1];
+        }
+        return true;
+    }
+
+    template<class T>
+    size_t ColumnBaseTyped<T>::getNumberOfDistinctValues() {
+        size_t sampleSize = std::min(this->size(), DISTINCT_VALUES_SAMPLE_SIZE);
+        PositionList sample(sampleSize);
+        for (size_t i = 0; i < sampleSize; i++) {
+            sample[i] = (TID) ((uint64_t) this->size() * i / sampleSize);
+        }
+        boost::scoped_array<T> values(new T[sampleSize]);
+        this->gather(sample, values.get());
+        std::sort(values.get(), values.get() + sampleSize);
+
+        size_t numberOfSingletons = 0;
+        size_t numberOfRepeatedValues = 0;
+        for (size_t i = 0; i < sampleSize;) {
+            size_t end = i + 1;
+            while (end < sampleSize && !(values[i] < values[end])) {
+                end++;
+            }
+            if (end - i == 1) {
+                numberOfSingletons++;
+            } else {
+                numberOfRepeatedValues++;
+            }
+            i = end;
+        }
+        //a sample of the whole column counts exactly, since the scale factor is 1
+        size_t estimate = (size_t) (std::sqrt((double) this->size() / std::max(sampleSize, (size_t) 1)) * numberOfSingletons) + numberOfRepeatedValues;
+        return std::min(estimate, this->size());
+    }
+
     template<class Type>
-    const PositionListPairPtr ColumnBaseTyped<Type>::nested_loop_join(ColumnPtr join_column_) {
+    const PositionListPairPtr ColumnBaseTyped<Type>::nested_loop_join(ColumnPtr join_column) {
+        return this->theta_join(join_column, EQUAL);
+    }
+
+    template<class T>
+    const PositionListPairPtr ColumnBaseTyped<T>::theta_join(ColumnPtr join_column_, const ValueComparator comp) {
         assert(join_column_ != NULL);
-        if (join_column_->type() != typeid (Type)) {
+        if (join_column_->type() != typeid (T)) {
             std::cout << "Fatal Error!!! Typemismatch for columns " << this->name_ << " and " << join_column_->getName() << std::endl;
             std::cout << "File: " << __FILE__ << " Line: " << __LINE__ << std::endl;
             exit(-1);
         }
 
-        shared_pointer_namespace::shared_ptr<ColumnBaseTyped<Type> > join_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<Type> >(join_column_); //static_cast<IntColumnPtr>(column1);
+        shared_pointer_namespace::shared_ptr<ColumnBaseTyped<T> > join_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<T> >(join_column_);
+
+        //the comparator is resolved once here, the join kernel is specialized for its comparator
+        if (comp == EQUAL) {
+            return this->block_nested_loop_join(*join_column, ComparatorCondition<T, EQUAL>());
+        } else if (comp == LESSER) {
+            return this->block_nested_loop_join(*join_column, ComparatorCondition<T, LESSER>());
+        } else if (comp == GREATER) {
+            return this->block_nested_loop_join(*join_column, ComparatorCondition<T, GREATER>());
+        } else if (comp == PREFIX && typeid (T) == typeid (std::string)) {
+            return this->block_nested_loop_join(*join_column, ComparatorCondition<T, PREFIX>());
+        } else if (comp == SUBSTRING && typeid (T) == typeid (std::string)) {
+            return this->block_nested_loop_join(*join_column, ComparatorCondition<T, SUBSTRING>());
+        }
 
+        //prefix and substring conditions only apply to strings
         PositionListPairPtr join_tids(new PositionListPair());
         join_tids->first = PositionListPtr(new PositionList());
         join_tids->second = PositionListPtr(new PositionList());
+        return join_tids;
+    }
 
-        for (unsigned int i = 0; i<this->size(); i++) {
-            for (unsigned int j = 0; j < join_column->size(); j++) {
-                if ((*this)[i] == (*join_column)[j]) {
-                    if (debug) std::cout << "MATCH: (" << i << "," << j << ")" << std::endl;
-                    join_tids->first->push_back(i);
-                    join_tids->second->push_back(j);
-                }
-            }
+    template<class T>
+    const PositionListPairPtr ColumnBaseTyped<T>::band_join(ColumnPtr join_column_, const boost::any& distance) {
+        assert(join_column_ != NULL);
+        if (join_column_->type() != typeid (T) || distance.type() != typeid (T)) {
+            std::cout << "Fatal Error!!! Typemismatch for columns " << this->name_ << " and " << join_column_->getName() << std::endl;
+            std::cout << "File: " << __FILE__ << " Line: " << __LINE__ << std::endl;
+            exit(-1);
         }
 
+        shared_pointer_namespace::shared_ptr<ColumnBaseTyped<T> > join_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<T> >(join_column_);
+        return this->block_nested_loop_join(*join_column, BandCondition<T>(boost::any_cast<T>(distance)));
+    }
+
+    template<class T>
+    template<class Condition>
+    const PositionListPairPtr ColumnBaseTyped<T>::block_nested_loop_join(ColumnBaseTyped<T>& join_column, const Condition& condition) {
+        PositionListPairPtr join_tids(new PositionListPair());
+        join_tids->first = PositionListPtr(new PositionList());
+        join_tids->second = PositionListPtr(new PositionList());
+
+        //the inner column is decoded once and read by all outer tiles
+        ThreadPool* pool = getParallelizationMode() == PARALLEL ? &ThreadPool::getGlobalThreadPool() : NULL;
+        boost::scoped_array<T> innerValues(new T[join_column.size()]);
+        join_column.decodeColumn(innerValues.get(), pool);
+
+        size_t numberOfTiles = (this->size() + DECODE_BATCH_SIZE - 1) / DECODE_BATCH_SIZE;
+        size_t numberOfChunks = pool == NULL ? 1 : std::min(numberOfTiles, (size_t) pool->getNumberOfThreads() * CHUNKS_PER_THREAD);
+        if (numberOfChunks <= 1) {
+            this->joinOuterChunk(innerValues.get(), join_column.size(), &condition, 0, this->size(), join_tids.get());
+            return join_tids;
+        }
+
+        //the chunks consist of whole tiles, so the tiles and with them the order of the pairs equal the ones of the serial join
+        std::vector<PositionListPair> chunkResults(numberOfChunks);
+        std::vector<ThreadPool::Task> tasks;
+        for (size_t i = 0; i < numberOfChunks; i++) {
+            TID begin = numberOfTiles * i / numberOfChunks * DECODE_BATCH_SIZE;
+            TID end = std::min(this->size(), numberOfTiles * (i + 1) / numberOfChunks * DECODE_BATCH_SIZE);
+            chunkResults[i].first = PositionListPtr(new PositionList());
+            chunkResults[i].second = PositionListPtr(new PositionList());
+            tasks.push_back(boost::bind(&ColumnBaseTyped<T>::joinOuterChunk<Condition>, this, innerValues.get(), join_column.size(), &condition, begin, end, &chunkResults[i]));
+        }
+        pool->execute(tasks);
+
+        std::vector<const PositionList*> firstChunks;
+        std::vector<const PositionList*> secondChunks;
+        for (size_t i = 0; i < numberOfChunks; i++) {
+            firstChunks.push_back(chunkResults[i].first.get());
+            secondChunks.push_back(chunkResults[i].second.get());
+        }
+        concatenateChunks(firstChunks, *join_tids->first, pool);
+        concatenateChunks(secondChunks, *join_tids->second, pool);
         return join_tids;
     }
 
+    template<class T>
+    template<class Condition>
+    void ColumnBaseTyped<T>::joinOuterChunk(const T* innerValues, size_t numberOfInnerValues, const Condition* condition, TID begin, TID end, PositionListPair* result) {
+        ColumnCursorPtr cursor = this->createCursor();
+        cursor->skipTo(begin);
+
+        boost::scoped_array<T> outerValues(new T[DECODE_BATCH_SIZE]);
+        boost::scoped_array<TID> matches(new TID[DECODE_BATCH_SIZE]);
+        for (TID outerBegin = begin; outerBegin < end; outerBegin += DECODE_BATCH_SIZE) {
+            size_t outerCount = std::min((size_t) DECODE_BATCH_SIZE, (size_t) (end - outerBegin));
+            cursor->nextBatch(outerValues.get(), outerCount);
+            for (TID innerBegin = 0; innerBegin < numberOfInnerValues; innerBegin += DECODE_BATCH_SIZE) {
+                size_t innerCount = std::min((size_t) DECODE_BATCH_SIZE, numberOfInnerValues - innerBegin);
+                joinTiles(outerValues.get(), outerCount, outerBegin, innerValues + innerBegin, innerCount, innerBegin, *condition, matches.get(), *result);
+            }
+        }
+    }
+
     template<class T>
     bool ColumnBaseTyped<T>::operator==(ColumnBaseTyped<T>& column) {
         if (this->size() != column.size()) return false;
-        for (unsigned int i = 0; i<this->size(); i++) {
-            if ((*this)[i] != column[i]) {
+        boost::scoped_array<T> values(new T[DECODE_BATCH_SIZE]);
+        boost::scoped_array<T> columnValues(new T[DECODE_BATCH_SIZE]);
+        for (TID begin = 0; begin<this->size(); begin += DECODE_BATCH_SIZE) {
+            size_t count = std::min((size_t) DECODE_BATCH_SIZE, this->size() - begin);
+            this->decode(begin, count, values.get());
+            column.decode(begin, count, columnValues.get());
+            for (size_t i = 0; i < count; i++) {
+                if (values[i] != columnValues[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<class T>
+    template<class Expression>
+    bool ColumnBaseTyped<T>::assign(const ColumnExpression<Expression>& expression) {
+        std::vector<T> values(expression.derived().size());
+        size_t numberOfBatches = (values.size() + DECODE_BATCH_SIZE - 1) / DECODE_BATCH_SIZE;
+        size_t numberOfChunks = std::min(numberOfBatches, getParallelizationMode() == PARALLEL ? (size_t) ThreadPool::getGlobalThreadPool().getNumberOfThreads() * CHUNKS_PER_THREAD : 1);
+        if (numberOfChunks == 1) {
+            evaluateChunk(expression.derived(), 0, values.size(), &values[0]);
+        } else if (numberOfChunks > 1) {
+            //chunks start at batch boundaries, so all chunks except the last one evaluate full batches
+            std::vector<ThreadPool::Task> tasks;
+            for (size_t i = 0; i < numberOfChunks; i++) {
+                TID begin = (TID) (numberOfBatches * i / numberOfChunks * DECODE_BATCH_SIZE);
+                TID end = (TID) std::min(values.size(), numberOfBatches * (i + 1) / numberOfChunks * DECODE_BATCH_SIZE);
+                tasks.push_back(boost::bind(&ColumnBaseTyped<T>::evaluateChunk<Expression>, expression.derived(), begin, end, &values[begin]));
+            }
+            ThreadPool::getGlobalThreadPool().execute(tasks);
+        }
+        return this->replaceContent(values);
+    }
+
+    template<class T>
+    template<class Expression>
+    void ColumnBaseTyped<T>::evaluateChunk(Expression expression, TID begin, TID end, T* out) {
+        for (TID batchBegin = begin; batchBegin < end; batchBegin += DECODE_BATCH_SIZE) {
+            size_t count = std::min((size_t) DECODE_BATCH_SIZE, (size_t) (end - batchBegin));
+            expression.load(batchBegin, count);
+            T* batchOut = out + (batchBegin - begin);
+            for (size_t i = 0; i < count; i++) {
+                batchOut[i] = expression[i];
+            }
+        }
+    }
+
+    template<class T>
+    bool ColumnBaseTyped<T>::replaceContent(std::vector<T>& values) {
+        if (!this->clearContent()) {
+            return false;
+        }
+        for (size_t i = 0; i < values.size(); i++) {
+            const T& value = values[i];
+            if (!this->insert(value)) {
                 return false;
             }
         }
         return true;
     }
 
+    template<class T>
+    bool ColumnBaseTyped<T>::transformValues(ArithmeticOperation, const T&) {
+        return false;
+    }
+
     template<class Type>
     bool ColumnBaseTyped<Type>::add(const boost::any& new_value) {
         if (new_value.empty()) return false;
         if (typeid (Type) == new_value.type()) {
             Type value = boost::any_cast<Type>(new_value);
-            //std::transform(myvec.begin(), myvec.end(), myvec.begin(),
-            //bind2nd(std::plus<double>(), 1.0));
-            for (unsigned int i = 0; i<this->size(); i++) {
-                this->operator[](i) += value;
+            if (this->transformValues(ADD, value)) {
+                return true;
             }
-            return true;
+            return this->assign(operand(*this) + value);
         }
         return false;
     }
 
     template<class Type>
     bool ColumnBaseTyped<Type>::add(ColumnPtr column) {
-        //std::transform ( first, first+5, second, results, std::plus<int>() );		
+        if (!column || column->type() != typeid (Type) || column->size() < this->size()) return false;
         shared_pointer_namespace::shared_ptr<ColumnBaseTyped<Type> > typed_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<Type> >(column);
-        if (!column) return false;
-        for (unsigned int i = 0; i<this->size(); i++) {
-            this->operator[](i) += typed_column->operator[](i);
-        }
-        return true;
+        return this->assign(operand(*this) + operand(*typed_column));
     }
 
     template<class Type>
     bool ColumnBaseTyped<Type>::minus(const boost::any& new_value) {
-        //shared_pointer_namespace::shared_ptr<ColumnBaseTyped<Type> > typed_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<Type> >(column);	
         if (new_value.empty()) return false;
         if (typeid (Type) == new_value.type()) {
             Type value = boost::any_cast<Type>(new_value);
-            for (unsigned int i = 0; i<this->size(); i++) {
-                this->operator[](i) -= value;
+            if (this->transformValues(SUBTRACT, value)) {
+                return true;
             }
-            return true;
+            return this->assign(operand(*this) - value);
         }
         return false;
     }
 
     template<class Type>
     bool ColumnBaseTyped<Type>::minus(ColumnPtr column) {
-        //std::transform ( first, first+5, second, results, std::plus<int>() );		
+        if (!column || column->type() != typeid (Type) || column->size() < this->size()) return false;
         shared_pointer_namespace::shared_ptr<ColumnBaseTyped<Type> > typed_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<Type> >(column);
-        if (!column) return false;
-        for (unsigned int i = 0; i<this->size(); i++) {
-            this->operator[](i) -= typed_column->operator[](i);
-        }
-        return true;
+        return this->assign(operand(*this) - operand(*typed_column));
     }
 
     template<class Type>
@@ -344,23 +999,19 @@ namespace CoGaDB {
         if (new_value.empty()) return false;
         if (typeid (Type) == new_value.type()) {
             Type value = boost::any_cast<Type>(new_value);
-            for (unsigned int i = 0; i<this->size(); i++) {
-                this->operator[](i) *= value;
+            if (this->transformValues(MULTIPLY, value)) {
+                return true;
             }
-            return true;
+            return this->assign(operand(*this) * value);
         }
         return false;
     }
 
     template<class Type>
     bool ColumnBaseTyped<Type>::multiply(ColumnPtr column) {
-        //std::transform ( first, first+5, second, results, std::plus<int>() );		
+        if (!column || column->type() != typeid (Type) || column->size() < this->size()) return false;
         shared_pointer_namespace::shared_ptr<ColumnBaseTyped<Type> > typed_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<Type> >(column);
-        if (!column) return false;
-        for (unsigned int i = 0; i<this->size(); i++) {
-            this->operator[](i) *= typed_column->operator[](i);
-        }
-        return true;
+        return this->assign(operand(*this) * operand(*typed_column));
     }
 
     template<class Type>
@@ -370,26 +1021,71 @@ namespace CoGaDB {
             Type value = boost::any_cast<Type>(new_value);
             //check that we do not devide by zero
             if (value == 0) return false;
-            for (unsigned int i = 0; i<this->size(); i++) {
-                this->operator[](i) /= value;
+            if (this->transformValues(DIVIDE, value)) {
+                return true;
             }
-            return true;
+            return this->assign(operand(*this) / value);
         }
         return false;
     }
 
     template<class Type>
     bool ColumnBaseTyped<Type>::division(ColumnPtr column) {
-        //std::transform ( first, first+5, second, results, std::plus<int>() );		
+        if (!column || column->type() != typeid (Type) || column->size() < this->size()) return false;
         shared_pointer_namespace::shared_ptr<ColumnBaseTyped<Type> > typed_column = shared_pointer_namespace::static_pointer_cast<ColumnBaseTyped<Type> >(column);
-        if (!column) return false;
-        for (unsigned int i = 0; i<this->size(); i++) {
-            this->operator[](i) /= typed_column->operator[](i);
-        }
-        return true;
+        return this->assign(operand(*this) / operand(*typed_column));
+    }
+
+    //total tempalte specializations, because numeric computations and band joins are undefined on strings 
+    //and numeric computations are undefined on booleans
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::add(const boost::any&) {
+        return false;
+    }
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::add(ColumnPtr) {
+        return false;
+    }
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::minus(const boost::any&) {
+        return false;
     }
 
-    //total tempalte specializations, because numeric computations are undefined on strings 
+    template<>
+    inline bool ColumnBaseTyped<bool>::minus(ColumnPtr) {
+        return false;
+    }
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::multiply(const boost::any&) {
+        return false;
+    }
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::multiply(ColumnPtr) {
+        return false;
+    }
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::division(const boost::any&) {
+        return false;
+    }
+
+    template<>
+    inline bool ColumnBaseTyped<bool>::division(ColumnPtr) {
+        return false;
+    }
+
+    template<>
+    inline const PositionListPairPtr ColumnBaseTyped<std::string>::band_join(ColumnPtr, const boost::any&) {
+        PositionListPairPtr join_tids(new PositionListPair());
+        join_tids->first = PositionListPtr(new PositionList());
+        join_tids->second = PositionListPtr(new PositionList());
+        return join_tids;
+    }
 
     template<>
     inline bool ColumnBaseTyped<std::string>::add(const boost::any&) {
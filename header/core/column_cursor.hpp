@@ -0,0 +1,228 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <boost/scoped_array.hpp>
+#include <iterator>
+#include <cstddef>
+#include <algorithm>
+
+namespace CoGaDB {
+
+    /*! \brief number of values a cursor decodes at once*/
+    const size_t CURSOR_BATCH_SIZE = 256;
+
+    template<class T>
+    class ColumnBaseTyped;
+
+    /*!
+     *  \brief     A ColumnCursor streams over the values of a column in TID order.
+     *  \details   The cursor decodes the column in small batches into an internal buffer. Derived cursors keep the decoding state of
+     *             their encoding between two batches (e.g., the current run or the position of the next exception), so a complete
+     *             scan costs linear time even for encodings whose random access is expensive. A cursor only moves forward, it must not
+     *             outlive its column and is invalidated by every modification of the column.
+     */
+    template<class T>
+    class ColumnCursor {
+    public:
+
+        /*! \brief an STL input iterator over the remaining values of a cursor*/
+        class iterator {
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            iterator(ColumnCursor<T>* cursor) : cursor(cursor) {
+            }
+
+            const T& operator*() const {
+                return cursor->current();
+            }
+
+            const T* operator->() const {
+                return &cursor->current();
+            }
+
+            iterator& operator++() {
+                cursor->advance();
+                return *this;
+            }
+
+            void operator++(int) {
+                cursor->advance();
+            }
+
+            //all iterators of exhausted cursors are equal to the end iterator
+            bool operator==(const iterator& other) const {
+                return atEnd() == other.atEnd();
+            }
+
+            bool operator!=(const iterator& other) const {
+                return atEnd() != other.atEnd();
+            }
+
+        private:
+
+            bool atEnd() const {
+                return cursor == NULL || !cursor->hasNext();
+            }
+
+            ColumnCursor<T>* cursor;
+        };
+
+        /***************** constructors and destructor *****************/
+        ColumnCursor(TID numberOfValues);
+        virtual ~ColumnCursor();
+
+        /*! \brief returns true, if there is a value left*/
+        bool hasNext() const;
+        /*! \brief returns the TID of the value the next call to next() returns*/
+        TID getPosition() const;
+        /*! \brief returns the current value and moves to the next one, the reference stays valid until the next call*/
+        const T& next();
+        /*! \brief moves forward to tid, the cursor never moves backwards*/
+        void skipTo(TID tid);
+        /*! \brief writes the next count values to out and moves behind them, count must not exceed the number of remaining values*/
+        void nextBatch(T* out, size_t count);
+
+        /*! \brief returns an iterator to the current value*/
+        iterator begin();
+        /*! \brief returns the end iterator*/
+        iterator end();
+
+    protected:
+
+        /*! \brief decodes the values [begin, begin+count) into out, begin is never lesser than the end of the previous batch*/
+        virtual void decodeNext(TID begin, size_t count, T* out) = 0;
+
+    private:
+
+        const T& current();
+        void advance();
+        void fillBuffer();
+
+        TID numberOfValues;
+        /*TID of the value the cursor points to*/
+        TID position;
+        /*TIDs [bufferBegin, bufferEnd) are decoded in buffer*/
+        TID bufferBegin;
+        TID bufferEnd;
+        boost::scoped_array<T> buffer;
+
+        ColumnCursor(const ColumnCursor&);
+        ColumnCursor& operator=(const ColumnCursor&);
+    };
+
+    /*!
+     *  \brief     A DecodeCursor reads its batches with the decode() method of a column, it is the cursor of all columns whose
+     *             decode() does not need state to find the start of a batch.
+     */
+    template<class T>
+    class DecodeCursor : public ColumnCursor<T> {
+    public:
+        DecodeCursor(ColumnBaseTyped<T>& column);
+
+    protected:
+        virtual void decodeNext(TID begin, size_t count, T* out);
+
+    private:
+        ColumnBaseTyped<T>& column;
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+    template<class T>
+    ColumnCursor<T>::ColumnCursor(TID numberOfValues) : numberOfValues(numberOfValues), position(0), bufferBegin(0), bufferEnd(0), buffer(new T[CURSOR_BATCH_SIZE]) {
+
+    }
+
+    template<class T>
+    ColumnCursor<T>::~ColumnCursor() {
+
+    }
+
+    template<class T>
+    bool ColumnCursor<T>::hasNext() const {
+        return position < numberOfValues;
+    }
+
+    template<class T>
+    TID ColumnCursor<T>::getPosition() const {
+        return position;
+    }
+
+    template<class T>
+    void ColumnCursor<T>::fillBuffer() {
+        bufferBegin = position;
+        bufferEnd = position + std::min(CURSOR_BATCH_SIZE, (size_t) (numberOfValues - position));
+        decodeNext(bufferBegin, bufferEnd - bufferBegin, buffer.get());
+    }
+
+    template<class T>
+    const T& ColumnCursor<T>::current() {
+        if (position >= bufferEnd) {
+            fillBuffer();
+        }
+        return buffer[position - bufferBegin];
+    }
+
+    template<class T>
+    void ColumnCursor<T>::advance() {
+        position++;
+    }
+
+    template<class T>
+    const T& ColumnCursor<T>::next() {
+        const T& value = current();
+        position++;
+        return value;
+    }
+
+    template<class T>
+    void ColumnCursor<T>::skipTo(TID tid) {
+        //values behind the buffer are decoded by the next batch, which starts at tid
+        if (tid > position) {
+            position = std::min(tid, numberOfValues);
+        }
+    }
+
+    template<class T>
+    void ColumnCursor<T>::nextBatch(T* out, size_t count) {
+        //values that are already decoded are copied, the rest is decoded directly into out
+        size_t numberOfBufferedValues = 0;
+        if (position >= bufferBegin && position < bufferEnd) {
+            numberOfBufferedValues = std::min(count, (size_t) (bufferEnd - position));
+            std::copy(buffer.get() + (position - bufferBegin), buffer.get() + (position - bufferBegin) + numberOfBufferedValues, out);
+            position += numberOfBufferedValues;
+        }
+        if (count > numberOfBufferedValues) {
+            decodeNext(position, count - numberOfBufferedValues, out + numberOfBufferedValues);
+            position += count - numberOfBufferedValues;
+        }
+    }
+
+    template<class T>
+    typename ColumnCursor<T>::iterator ColumnCursor<T>::begin() {
+        return iterator(this);
+    }
+
+    template<class T>
+    typename ColumnCursor<T>::iterator ColumnCursor<T>::end() {
+        return iterator(NULL);
+    }
+
+    template<class T>
+    DecodeCursor<T>::DecodeCursor(ColumnBaseTyped<T>& column) : ColumnCursor<T>(column.size()), column(column) {
+
+    }
+
+    template<class T>
+    void DecodeCursor<T>::decodeNext(TID begin, size_t count, T* out) {
+        column.decode(begin, count, out);
+    }
+
+    /***************** End of Implementation Section ******************/
+
+}; //end namespace CogaDB
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <string>
+
+namespace CoGaDB {
+
+    template<class T>
+    class ColumnBaseTyped;
+
+    /*! \brief returns 'value operation constant'*/
+    template<class T>
+    inline T applyArithmeticOperation(const T& value, const T& constant, const ArithmeticOperation operation) {
+        if (operation == ADD) {
+            return value + constant;
+        } else if (operation == SUBTRACT) {
+            return value - constant;
+        } else if (operation == MULTIPLY) {
+            return value * constant;
+        }
+        return value / constant;
+    }
+
+    /*! \brief returns the value unchanged, arithmetic operations are undefined on strings*/
+    inline std::string applyArithmeticOperation(const std::string& value, const std::string&, const ArithmeticOperation) {
+        return value;
+    }
+
+    /*!
+     *  \brief     ColumnExpression is the base of all nodes of an arithmetic expression over columns, e.g., (operand(a) + operand(b)) * operand(c) - 1.
+     *  \details   The operators +, -, * and / build the expression as a tree of nodes at compile time, so no operator is evaluated
+     *             when the expression is built. ColumnBaseTyped::assign() evaluates the whole tree per batch: load() decodes a batch of
+     *             every operand column and operator[] computes one value of the batch, which the compiler inlines into a single loop.
+     *             Derived is the type of the node, every node has the members value_type, size(), load() and operator[].
+     */
+    template<class Derived>
+    struct ColumnExpression {
+
+        const Derived& derived() const {
+            return static_cast<const Derived&> (*this);
+        }
+    };
+
+    /*! \brief a ColumnOperand is a leaf of an expression, which decodes the batches of a column*/
+    template<class T>
+    class ColumnOperand : public ColumnExpression<ColumnOperand<T> > {
+    public:
+        typedef T value_type;
+
+        explicit ColumnOperand(ColumnBaseTyped<T>& column);
+
+        /*! \brief returns the number of values of the column*/
+        size_t size() const;
+        /*! \brief decodes the values [begin, begin + count) of the column*/
+        void load(TID begin, size_t count);
+
+        T operator[](size_t i) const {
+            return values[i];
+        }
+
+    private:
+        ColumnBaseTyped<T>* column;
+        /*values of the current batch, every copy of the operand decodes into its own batch*/
+        std::vector<T> values;
+    };
+
+    /*! \brief a ConstantOperand is a leaf of an expression, which has the same value in every row*/
+    template<class T>
+    class ConstantOperand : public ColumnExpression<ConstantOperand<T> > {
+    public:
+        typedef T value_type;
+
+        explicit ConstantOperand(const T& value) : value(value) {
+        }
+
+        /*! \brief returns the maximal size, a constant does not limit the size of an expression*/
+        size_t size() const {
+            return std::numeric_limits<size_t>::max();
+        }
+
+        void load(TID, size_t) {
+        }
+
+        T operator[](size_t) const {
+            return value;
+        }
+
+    private:
+        T value;
+    };
+
+    /*! \brief a BinaryExpression applies Operation, e.g., std::plus, to the values of two expressions of the same row*/
+    template<class Left, class Right, class Operation>
+    class BinaryExpression : public ColumnExpression<BinaryExpression<Left, Right, Operation> > {
+    public:
+        typedef typename Left::value_type value_type;
+
+        BinaryExpression(const Left& left, const Right& right) : left(left), right(right) {
+        }
+
+        /*! \brief returns the smaller size of both expressions*/
+        size_t size() const {
+            return std::min(left.size(), right.size());
+        }
+
+        void load(TID begin, size_t count) {
+            left.load(begin, count);
+            right.load(begin, count);
+        }
+
+        value_type operator[](size_t i) const {
+            return Operation()(left[i], right[i]);
+        }
+
+    private:
+        Left left;
+        Right right;
+    };
+
+    /*! \brief returns a leaf of an expression for the column, the column has to outlive the expression*/
+    template<class T>
+    ColumnOperand<T> operand(ColumnBaseTyped<T>& column) {
+        return ColumnOperand<T>(column);
+    }
+
+    /***************** operators building expressions, constants have the value type of the expression *****************/
+
+    template<class Left, class Right>
+    BinaryExpression<Left, Right, std::plus<typename Left::value_type> > operator+(const ColumnExpression<Left>& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<Left, Right, std::plus<typename Left::value_type> >(left.derived(), right.derived());
+    }
+
+    template<class Left>
+    BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::plus<typename Left::value_type> > operator+(const ColumnExpression<Left>& left, const typename Left::value_type& right) {
+        return BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::plus<typename Left::value_type> >(left.derived(), ConstantOperand<typename Left::value_type>(right));
+    }
+
+    template<class Right>
+    BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::plus<typename Right::value_type> > operator+(const typename Right::value_type& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::plus<typename Right::value_type> >(ConstantOperand<typename Right::value_type>(left), right.derived());
+    }
+
+    template<class Left, class Right>
+    BinaryExpression<Left, Right, std::minus<typename Left::value_type> > operator-(const ColumnExpression<Left>& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<Left, Right, std::minus<typename Left::value_type> >(left.derived(), right.derived());
+    }
+
+    template<class Left>
+    BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::minus<typename Left::value_type> > operator-(const ColumnExpression<Left>& left, const typename Left::value_type& right) {
+        return BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::minus<typename Left::value_type> >(left.derived(), ConstantOperand<typename Left::value_type>(right));
+    }
+
+    template<class Right>
+    BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::minus<typename Right::value_type> > operator-(const typename Right::value_type& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::minus<typename Right::value_type> >(ConstantOperand<typename Right::value_type>(left), right.derived());
+    }
+
+    template<class Left, class Right>
+    BinaryExpression<Left, Right, std::multiplies<typename Left::value_type> > operator*(const ColumnExpression<Left>& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<Left, Right, std::multiplies<typename Left::value_type> >(left.derived(), right.derived());
+    }
+
+    template<class Left>
+    BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::multiplies<typename Left::value_type> > operator*(const ColumnExpression<Left>& left, const typename Left::value_type& right) {
+        return BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::multiplies<typename Left::value_type> >(left.derived(), ConstantOperand<typename Left::value_type>(right));
+    }
+
+    template<class Right>
+    BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::multiplies<typename Right::value_type> > operator*(const typename Right::value_type& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::multiplies<typename Right::value_type> >(ConstantOperand<typename Right::value_type>(left), right.derived());
+    }
+
+    template<class Left, class Right>
+    BinaryExpression<Left, Right, std::divides<typename Left::value_type> > operator/(const ColumnExpression<Left>& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<Left, Right, std::divides<typename Left::value_type> >(left.derived(), right.derived());
+    }
+
+    template<class Left>
+    BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::divides<typename Left::value_type> > operator/(const ColumnExpression<Left>& left, const typename Left::value_type& right) {
+        return BinaryExpression<Left, ConstantOperand<typename Left::value_type>, std::divides<typename Left::value_type> >(left.derived(), ConstantOperand<typename Left::value_type>(right));
+    }
+
+    template<class Right>
+    BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::divides<typename Right::value_type> > operator/(const typename Right::value_type& left, const ColumnExpression<Right>& right) {
+        return BinaryExpression<ConstantOperand<typename Right::value_type>, Right, std::divides<typename Right::value_type> >(ConstantOperand<typename Right::value_type>(left), right.derived());
+    }
+
+    /***************** Start of Implementation Section ******************/
+
+    template<class T>
+    ColumnOperand<T>::ColumnOperand(ColumnBaseTyped<T>& column) : column(&column), values() {
+    }
+
+    template<class T>
+    size_t ColumnOperand<T>::size() const {
+        return column->size();
+    }
+
+    template<class T>
+    void ColumnOperand<T>::load(TID begin, size_t count) {
+        //the batch is allocated by the first load, so copying an operand before the evaluation is cheap
+        if (values.size() < count) {
+            values.resize(count);
+        }
+        column->decode(begin, count, &values[0]);
+    }
+
+    /***************** End of Implementation Section ******************/
+
+}; //end namespace CogaDB
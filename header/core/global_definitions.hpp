@@ -26,19 +26,23 @@ namespace CoGaDB {
     };
 
     enum ValueComparator {
-        LESSER, GREATER, EQUAL
+        LESSER, GREATER, EQUAL, PREFIX, SUBSTRING
     };
 
     enum SortOrder {
         ASCENDING, DESCENDING
     };
 
+    enum ArithmeticOperation {
+        ADD, SUBTRACT, MULTIPLY, DIVIDE
+    };
+
     enum Operation {
         SELECTION, PROJECTION, JOIN, GROUPBY, SORT, COPY, AGGREGATION, FULL_SCAN, INDEX_SCAN
     };
 
     enum JoinAlgorithm {
-        SORT_MERGE_JOIN, NESTED_LOOP_JOIN, HASH_JOIN
+        SORT_MERGE_JOIN, NESTED_LOOP_JOIN, HASH_JOIN, AUTO
     };
 
     enum MaterializationStatus {
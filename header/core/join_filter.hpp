@@ -0,0 +1,160 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <boost/functional/hash.hpp>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+namespace CoGaDB {
+
+    /*! \brief number of bits a JoinFilter spends per key, a bloom filter of this size has a false positive rate below one percent*/
+    const size_t JOIN_FILTER_BITS_PER_KEY = 16;
+    /*! \brief the hash join filters the probe column with the keys of the build column, if the probe column is at least this many times larger*/
+    const size_t JOIN_FILTER_MIN_PROBE_RATIO = 4;
+    /*! \brief number of 32 bit words of a block of the bloom filter, so a block fills half a cache line*/
+    const size_t BLOOM_FILTER_BLOCK_WORDS = 8;
+
+    /*! \brief odd multipliers that select the bit of a key in each word of a bloom filter block*/
+    const uint32_t BLOOM_FILTER_SALTS[BLOOM_FILTER_BLOCK_WORDS] = {
+        0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u
+    };
+
+    /*! \brief returns false, values of type T have no integer domain that a JoinFilter could store as exact bitmap*/
+    template<class T>
+    inline bool getIntegerKey(const T&, int64_t&) {
+        return false;
+    }
+
+    /*! \brief returns true and the value as key, int values are stored as exact bitmap if their domain is small*/
+    inline bool getIntegerKey(const int& value, int64_t& key) {
+        key = value;
+        return true;
+    }
+
+    /*!
+     *  \brief     A JoinFilter holds the keys of the build column of a join, so the scan of the probe column drops the tuples
+     *             without join partner before they are joined.
+     *  \details   Integer keys whose domain [minimum, maximum] has at most JOIN_FILTER_BITS_PER_KEY values per key are stored
+     *             exactly in a bitmap. All other keys are stored in a blocked bloom filter: every key sets one bit in each word
+     *             of one block, so a lookup touches a single cache line and tests all words without a branch. mayContain() never
+     *             returns false for a key of the filter; the bloom filter returns true for some other keys as well.
+     */
+    template<class T>
+    class JoinFilter {
+    public:
+        /***************** constructors and destructor *****************/
+        JoinFilter(const T* keys, size_t numberOfKeys);
+
+        /*! \brief returns false, if key is no key of the filter*/
+        bool mayContain(const T& key) const;
+        /*! \brief returns true, if mayContain() returns true only for the keys of the filter*/
+        bool isExact() const;
+
+    private:
+
+        //returns the hash of a key, the upper half selects the block and the lower half the bits in the block
+        static uint64_t getHash(const T& key);
+        const uint32_t* getBlock(uint64_t hash) const;
+
+        bool exact;
+        /*bitmap of the keys [minimum, minimum + domainSize) of an exact filter*/
+        int64_t minimum;
+        uint64_t domainSize;
+        std::vector<uint64_t> bitmap;
+        /*vector<[BLOCK * BLOOM_FILTER_BLOCK_WORDS + WORD]>*/
+        std::vector<uint32_t> blocks;
+        uint64_t numberOfBlocks;
+    };
+
+    /*! \brief a JoinFilterPredicate matches all values a JoinFilter may contain*/
+    template<class T>
+    struct JoinFilterPredicate {
+
+        explicit JoinFilterPredicate(const JoinFilter<T>& filter) : filter(filter) {
+        }
+
+        bool operator()(const T& value) const {
+            return filter.mayContain(value);
+        }
+
+        const JoinFilter<T>& filter;
+    };
+
+    /***************** Start of Implementation Section ******************/
+
+    template<class T>
+    JoinFilter<T>::JoinFilter(const T* keys, size_t numberOfKeys) : exact(false), minimum(0), domainSize(0), bitmap(), blocks(), numberOfBlocks(0) {
+        int64_t key = 0;
+        if (numberOfKeys > 0 && getIntegerKey(keys[0], key)) {
+            int64_t maximum = key;
+            minimum = key;
+            for (size_t i = 1; i < numberOfKeys; i++) {
+                getIntegerKey(keys[i], key);
+                minimum = std::min(minimum, key);
+                maximum = std::max(maximum, key);
+            }
+            //the bitmap is used, if it is not larger than the bloom filter
+            domainSize = (uint64_t) (maximum - minimum) + 1;
+            exact = domainSize <= numberOfKeys * JOIN_FILTER_BITS_PER_KEY;
+        }
+
+        if (exact) {
+            bitmap.assign((domainSize + 63) / 64, 0);
+            for (size_t i = 0; i < numberOfKeys; i++) {
+                getIntegerKey(keys[i], key);
+                uint64_t offset = (uint64_t) (key - minimum);
+                bitmap[offset / 64] |= uint64_t(1) << (offset % 64);
+            }
+            return;
+        }
+
+        numberOfBlocks = std::max((uint64_t) 1, (uint64_t) (numberOfKeys * JOIN_FILTER_BITS_PER_KEY / (BLOOM_FILTER_BLOCK_WORDS * 32)));
+        blocks.assign(numberOfBlocks * BLOOM_FILTER_BLOCK_WORDS, 0);
+        for (size_t i = 0; i < numberOfKeys; i++) {
+            uint64_t hash = getHash(keys[i]);
+            uint32_t* block = const_cast<uint32_t*> (getBlock(hash));
+            for (size_t w = 0; w < BLOOM_FILTER_BLOCK_WORDS; w++) {
+                block[w] |= uint32_t(1) << ((uint32_t) hash * BLOOM_FILTER_SALTS[w] >> 27);
+            }
+        }
+    }
+
+    template<class T>
+    bool JoinFilter<T>::mayContain(const T& key) const {
+        if (exact) {
+            int64_t integerKey = 0;
+            getIntegerKey(key, integerKey);
+            //keys below minimum wrap around to large offsets
+            uint64_t offset = (uint64_t) (integerKey - minimum);
+            return offset < domainSize && ((bitmap[offset / 64] >> (offset % 64)) & 1);
+        }
+        uint64_t hash = getHash(key);
+        const uint32_t* block = getBlock(hash);
+        uint32_t missingBits = 0;
+        for (size_t w = 0; w < BLOOM_FILTER_BLOCK_WORDS; w++) {
+            missingBits |= ~block[w] & (uint32_t(1) << ((uint32_t) hash * BLOOM_FILTER_SALTS[w] >> 27));
+        }
+        return missingBits == 0;
+    }
+
+    template<class T>
+    bool JoinFilter<T>::isExact() const {
+        return exact;
+    }
+
+    template<class T>
+    uint64_t JoinFilter<T>::getHash(const T& key) {
+        //boost::hash is the identity for integers, the multiplication spreads every bit of it to the upper half
+        return (uint64_t) boost::hash<T>()(key) * 0x9E3779B97F4A7C15ull;
+    }
+
+    template<class T>
+    const uint32_t* JoinFilter<T>::getBlock(uint64_t hash) const {
+        //maps the upper half of the hash to [0, numberOfBlocks) without a division
+        return &blocks[((hash >> 32) * numberOfBlocks >> 32) * BLOOM_FILTER_BLOCK_WORDS];
+    }
+
+    /***************** End of Implementation Section ******************/
+
+}; //end namespace CogaDB
@@ -0,0 +1,326 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <core/base_column.hpp>
+#include <core/thread_pool.hpp>
+#include <core/selection_kernels.hpp>
+#include <boost/functional/hash.hpp>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+namespace CoGaDB {
+
+    /*! \brief maximal number of build tuples per partition of the hash join, so the hash table of a partition fits into the L2 cache*/
+    const size_t JOIN_PARTITION_SIZE = 8192;
+    /*! \brief maximal number of bits the hash join partitions by, more partitions than TLB entries slow down the partitioning*/
+    const unsigned int JOIN_MAX_RADIX_BITS = 10;
+    /*! \brief minimal number of tuples per task of the hash join*/
+    const size_t JOIN_GRAIN_SIZE = 16384;
+    /*! \brief marks an unused slot of a join hash table and the end of a chain of duplicates*/
+    const uint32_t JOIN_EMPTY_SLOT = ~0u;
+    /*! \brief columns of at most this many values are joined by the nested loop join, if the join algorithm is chosen automatically*/
+    const size_t NESTED_LOOP_JOIN_MAX_SIZE = 32;
+    /*! \brief columns with at most this many distinct values are joined by the nested loop join, if the join algorithm is chosen automatically*/
+    const size_t NESTED_LOOP_JOIN_MAX_DISTINCT_VALUES = 2;
+    /*! \brief number of values the number of distinct values of a column is estimated from*/
+    const size_t DISTINCT_VALUES_SAMPLE_SIZE = 1024;
+
+    /*! \brief returns the hash of a join key, the low bits select the partition of the key and the next bits its slot*/
+    template<class T>
+    inline uint32_t getJoinHash(const T& value) {
+        //boost::hash is the identity for integers, the multiplication spreads every bit of it to the upper half
+        uint64_t hash = (uint64_t) boost::hash<T>()(value) * 0x9E3779B97F4A7C15ull;
+        return (uint32_t) (hash >> 32);
+    }
+
+    /*!
+     *  \brief     The HashPartitions of a join input hold the hashes and TIDs of its tuples ordered by partition.
+     *  \details   The tuples of partition p are [partitionBegins[p], partitionBegins[p+1]), within a partition the TIDs are ascending.
+     */
+    struct HashPartitions {
+        std::vector<uint32_t> hashes;
+        PositionList positions;
+        std::vector<size_t> partitionBegins;
+    };
+
+    /*!
+     *  \brief     A PartitionedHashTable holds one open addressing hash table per build partition.
+     *  \details   The slots of partition p are [slotBegins[p], slotBegins[p+1]), a power of two of them. Every used slot holds the
+     *             index of the first build tuple of one distinct key, the further tuples of the key are chained in ascending TID
+     *             order by next. A key with many duplicates therefore occupies one slot and never lengthens the probe sequences.
+     */
+    struct PartitionedHashTable {
+        std::vector<uint32_t> slots;
+        std::vector<size_t> slotBegins;
+        /*vector<[INDEX_OF_NEXT_TUPLE_WITH_EQUAL_KEY]>, indexed like the tuples of the build partitions*/
+        std::vector<uint32_t> next;
+    };
+
+    //computes the hashes of the values in [begin, end) and counts them per partition
+    template<class T>
+    void countPartitions(const T* values, size_t begin, size_t end, uint32_t partitionMask, uint32_t* hashes, size_t* histogram) {
+        std::fill(histogram, histogram + partitionMask + 1, 0);
+        for (size_t i = begin; i < end; i++) {
+            hashes[i] = getJoinHash(values[i]);
+            histogram[hashes[i] & partitionMask]++;
+        }
+    }
+
+    //moves the hashes and TIDs of [begin, end) to their partitions, offsets holds the next position per partition
+    inline void scatterPartitions(const uint32_t* hashes, size_t begin, size_t end, uint32_t partitionMask, size_t* offsets, HashPartitions* partitions) {
+        for (size_t i = begin; i < end; i++) {
+            size_t target = offsets[hashes[i] & partitionMask]++;
+            partitions->hashes[target] = hashes[i];
+            partitions->positions[target] = i;
+        }
+    }
+
+    /*!
+     * \brief partitions the TIDs 0..numberOfValues-1 by the low radixBits bits of the hashes of their values
+     * \details The partitioning is a single counting pass and a single scatter pass. With a pool, every chunk of the values is
+     * counted and scattered by its own task; the offsets of a chunk start behind the same partition of all previous chunks, so
+     * the result is the same as the one of the serial partitioning.
+     */
+    template<class T>
+    void partitionByHash(const T* values, size_t numberOfValues, unsigned int radixBits, HashPartitions& partitions, ThreadPool* pool) {
+        size_t numberOfPartitions = (size_t) 1 << radixBits;
+        uint32_t partitionMask = numberOfPartitions - 1;
+        partitions.partitionBegins.assign(numberOfPartitions + 1, 0);
+        partitions.hashes.resize(numberOfValues);
+        partitions.positions.resize(numberOfValues);
+        if (numberOfValues == 0) {
+            return;
+        }
+
+        size_t numberOfChunks = pool == NULL ? 1 : std::max((size_t) 1, std::min((size_t) pool->getNumberOfThreads(), numberOfValues / JOIN_GRAIN_SIZE));
+        std::vector<size_t> chunkBegins(numberOfChunks + 1);
+        for (size_t c = 0; c <= numberOfChunks; c++) {
+            chunkBegins[c] = numberOfValues * c / numberOfChunks;
+        }
+        std::vector<uint32_t> hashes(numberOfValues);
+        /*vector<[CHUNK * NUMBER_OF_PARTITIONS + PARTITION]>*/
+        std::vector<size_t> histograms(numberOfChunks * numberOfPartitions);
+
+        if (numberOfChunks == 1) {
+            countPartitions(values, 0, numberOfValues, partitionMask, &hashes[0], &histograms[0]);
+        } else {
+            std::vector<ThreadPool::Task> tasks;
+            for (size_t c = 0; c < numberOfChunks; c++) {
+                tasks.push_back(boost::bind(&countPartitions<T>, values, chunkBegins[c], chunkBegins[c + 1], partitionMask, &hashes[0], &histograms[c * numberOfPartitions]));
+            }
+            pool->execute(tasks);
+        }
+
+        //the offsets of partition p in chunk c follow all smaller partitions and partition p of all previous chunks
+        size_t offset = 0;
+        for (size_t p = 0; p < numberOfPartitions; p++) {
+            partitions.partitionBegins[p] = offset;
+            for (size_t c = 0; c < numberOfChunks; c++) {
+                size_t chunkCount = histograms[c * numberOfPartitions + p];
+                histograms[c * numberOfPartitions + p] = offset;
+                offset += chunkCount;
+            }
+        }
+        partitions.partitionBegins[numberOfPartitions] = offset;
+
+        if (numberOfChunks == 1) {
+            scatterPartitions(&hashes[0], 0, numberOfValues, partitionMask, &histograms[0], &partitions);
+        } else {
+            std::vector<ThreadPool::Task> tasks;
+            for (size_t c = 0; c < numberOfChunks; c++) {
+                tasks.push_back(boost::bind(&scatterPartitions, &hashes[0], chunkBegins[c], chunkBegins[c + 1], partitionMask, &histograms[c * numberOfPartitions], &partitions));
+            }
+            pool->execute(tasks);
+        }
+    }
+
+    //inserts the build tuples of the partitions [firstPartition, lastPartition) into their hash tables
+    template<class T>
+    void buildPartitions(const T* values, const HashPartitions* build, unsigned int radixBits, size_t firstPartition, size_t lastPartition, PartitionedHashTable* table) {
+        for (size_t p = firstPartition; p < lastPartition; p++) {
+            uint32_t* slots = &table->slots[0] + table->slotBegins[p];
+            uint32_t slotMask = table->slotBegins[p + 1] - table->slotBegins[p] - 1;
+            //the tuples are inserted backwards, so every chain lists the TIDs of its key in ascending order
+            for (size_t i = build->partitionBegins[p + 1]; i-- > build->partitionBegins[p];) {
+                uint32_t hash = build->hashes[i];
+                const T& value = values[build->positions[i]];
+                uint32_t slot = (hash >> radixBits) & slotMask;
+                while (slots[slot] != JOIN_EMPTY_SLOT
+                        && !(build->hashes[slots[slot]] == hash && values[build->positions[slots[slot]]] == value)) {
+                    slot = (slot + 1) & slotMask;
+                }
+                table->next[i] = slots[slot];
+                slots[slot] = i;
+            }
+        }
+    }
+
+    //probes the hash tables with the probe tuples [begin, end) and appends the TIDs of all matches to result
+    template<class T>
+    void probePartitions(const T* buildValues, const HashPartitions* build, const PartitionedHashTable* table, const T* probeValues,
+            const HashPartitions* probe, unsigned int radixBits, size_t begin, size_t end, PositionListPair* result) {
+        //the buffers are sized for a foreign key join, which finds one match per probe tuple
+        result->first->reserve(end - begin);
+        result->second->reserve(end - begin);
+        uint32_t partitionMask = ((uint32_t) 1 << radixBits) - 1;
+        for (size_t i = begin; i < end; i++) {
+            uint32_t hash = probe->hashes[i];
+            const T& value = probeValues[probe->positions[i]];
+            size_t partition = hash & partitionMask;
+            const uint32_t* slots = &table->slots[0] + table->slotBegins[partition];
+            uint32_t slotMask = table->slotBegins[partition + 1] - table->slotBegins[partition] - 1;
+            uint32_t slot = (hash >> radixBits) & slotMask;
+            while (slots[slot] != JOIN_EMPTY_SLOT) {
+                uint32_t first = slots[slot];
+                if (build->hashes[first] == hash && buildValues[build->positions[first]] == value) {
+                    for (uint32_t match = first; match != JOIN_EMPTY_SLOT; match = table->next[match]) {
+                        result->first->push_back(build->positions[match]);
+                        result->second->push_back(probe->positions[i]);
+                    }
+                    break;
+                }
+                slot = (slot + 1) & slotMask;
+            }
+        }
+    }
+
+    /*!
+     * \brief joins the build values with the probe values on equality, results holds the TIDs (build TID, probe TID) of all matches
+     * \details Both inputs are radix partitioned by the low bits of the hashes of their values, so the build tuples of a partition
+     * fit into the cache. Every build partition gets its own open addressing hash table with at least twice as many slots as tuples.
+     * The partitioned probe tuples are split into ranges, every range is probed by one task into its own entry of results, which is
+     * reserved for one match per probe tuple. The concatenation of results is the join result; its order only depends on the
+     * values, the probe tuples are ordered by partition and ascending TID, the matches of a probe tuple by ascending build TID.
+     * Without a pool, all steps run on the calling thread.
+     */
+    template<class T>
+    void radixHashJoin(const T* buildValues, size_t buildSize, const T* probeValues, size_t probeSize, std::vector<PositionListPair>& results, ThreadPool* pool) {
+        unsigned int radixBits = 0;
+        while (radixBits < JOIN_MAX_RADIX_BITS && (buildSize >> radixBits) > JOIN_PARTITION_SIZE) {
+            radixBits++;
+        }
+        size_t numberOfPartitions = (size_t) 1 << radixBits;
+
+        HashPartitions build;
+        HashPartitions probe;
+        partitionByHash(buildValues, buildSize, radixBits, build, pool);
+        partitionByHash(probeValues, probeSize, radixBits, probe, pool);
+
+        PartitionedHashTable table;
+        table.slotBegins.assign(numberOfPartitions + 1, 0);
+        for (size_t p = 0; p < numberOfPartitions; p++) {
+            size_t numberOfSlots = 2;
+            while (numberOfSlots < 2 * (build.partitionBegins[p + 1] - build.partitionBegins[p])) {
+                numberOfSlots <<= 1;
+            }
+            table.slotBegins[p + 1] = table.slotBegins[p] + numberOfSlots;
+        }
+        table.slots.assign(table.slotBegins[numberOfPartitions], JOIN_EMPTY_SLOT);
+        table.next.resize(buildSize);
+
+        size_t numberOfBuildTasks = pool == NULL ? 1 : std::min(numberOfPartitions, (size_t) pool->getNumberOfThreads() * CHUNKS_PER_THREAD);
+        if (numberOfBuildTasks == 1) {
+            buildPartitions(buildValues, &build, radixBits, 0, numberOfPartitions, &table);
+        } else {
+            std::vector<ThreadPool::Task> tasks;
+            for (size_t t = 0; t < numberOfBuildTasks; t++) {
+                tasks.push_back(boost::bind(&buildPartitions<T>, buildValues, &build, radixBits,
+                        numberOfPartitions * t / numberOfBuildTasks, numberOfPartitions * (t + 1) / numberOfBuildTasks, &table));
+            }
+            pool->execute(tasks);
+        }
+
+        //the probe ranges ignore the partition boundaries, so a small build side does not limit the parallelism of the probe
+        size_t numberOfProbeTasks = pool == NULL ? 1 : std::max((size_t) 1, std::min((size_t) pool->getNumberOfThreads() * CHUNKS_PER_THREAD, probeSize / JOIN_GRAIN_SIZE));
+        results.resize(numberOfProbeTasks);
+        for (size_t t = 0; t < numberOfProbeTasks; t++) {
+            results[t].first = PositionListPtr(new PositionList());
+            results[t].second = PositionListPtr(new PositionList());
+        }
+        if (numberOfProbeTasks == 1) {
+            probePartitions(buildValues, &build, &table, probeValues, &probe, radixBits, 0, probeSize, &results[0]);
+        } else {
+            std::vector<ThreadPool::Task> tasks;
+            for (size_t t = 0; t < numberOfProbeTasks; t++) {
+                tasks.push_back(boost::bind(&probePartitions<T>, buildValues, &build, &table, probeValues, &probe, radixBits,
+                        probeSize * t / numberOfProbeTasks, probeSize * (t + 1) / numberOfProbeTasks, &results[t]));
+            }
+            pool->execute(tasks);
+        }
+    }
+
+    /*! \brief a ComparatorCondition joins an outer value with an inner value, if 'outer comp inner' holds*/
+    template<class T, ValueComparator comp>
+    struct ComparatorCondition {
+        typedef ComparatorPredicate<T, comp> Predicate;
+
+        Predicate getPredicate(const T& inner) const {
+            return Predicate(inner);
+        }
+    };
+
+    /*! \brief a BandCondition joins an outer value with an inner value, if 'inner - distance <= outer <= inner + distance' holds*/
+    template<class T>
+    struct BandCondition {
+        typedef BetweenPredicate<T> Predicate;
+
+        explicit BandCondition(const T& distance) : distance(distance) {
+        }
+
+        Predicate getPredicate(const T& inner) const {
+            return Predicate(inner - distance, inner + distance);
+        }
+
+        T distance;
+    };
+
+    /*!
+     * \brief joins a tile of outer values with a tile of inner values and appends the TIDs (outer TID, inner TID) of all matches to result
+     * \details Every inner value becomes the constant of a predicate, which selectBatch() evaluates on the whole outer tile without
+     * a data dependent branch. matches has to have room for outerCount TIDs. The matches are ordered by inner TID and outer TID.
+     */
+    template<class T, class Condition>
+    void joinTiles(const T* outerValues, size_t outerCount, TID outerBegin, const T* innerValues, size_t innerCount, TID innerBegin,
+            const Condition& condition, TID* matches, PositionListPair& result) {
+        for (size_t j = 0; j < innerCount; j++) {
+            size_t numberOfMatches = selectBatch(outerValues, outerCount, outerBegin, condition.getPredicate(innerValues[j]), matches);
+            result.first->insert(result.first->end(), matches, matches + numberOfMatches);
+            result.second->insert(result.second->end(), numberOfMatches, (TID) (innerBegin + j));
+        }
+    }
+
+    /*!
+     * \brief merges two inputs sorted ascending by value and appends the TIDs (left TID, right TID) of all pairs of equal values to result
+     * \details leftPositions holds the TIDs of the sorted leftValues, rightPositions the ones of rightValues. Every group of equal
+     * values of one input is joined with the group of the same value of the other input.
+     */
+    template<class T>
+    void mergeJoin(const T* leftValues, const PositionList& leftPositions, const T* rightValues, const PositionList& rightPositions, PositionListPair& result) {
+        size_t left = 0;
+        size_t right = 0;
+        while (left < leftPositions.size() && right < rightPositions.size()) {
+            if (leftValues[left] < rightValues[right]) {
+                left++;
+            } else if (rightValues[right] < leftValues[left]) {
+                right++;
+            } else {
+                size_t leftEnd = left + 1;
+                while (leftEnd < leftPositions.size() && !(leftValues[left] < leftValues[leftEnd])) {
+                    leftEnd++;
+                }
+                size_t rightEnd = right + 1;
+                while (rightEnd < rightPositions.size() && !(rightValues[right] < rightValues[rightEnd])) {
+                    rightEnd++;
+                }
+                for (size_t i = left; i < leftEnd; i++) {
+                    result.first->insert(result.first->end(), rightEnd - right, leftPositions[i]);
+                    result.second->insert(result.second->end(), rightPositions.begin() + right, rightPositions.begin() + rightEnd);
+                }
+                left = leftEnd;
+                right = rightEnd;
+            }
+        }
+    }
+
+}; //end namespace CogaDB
@@ -42,6 +42,10 @@ namespace CoGaDB {
         virtual unsigned int getSizeinBytes() const throw ();
 
         virtual const ColumnPtr copy() const;
+        /*! \brief translates the range to TIDs of the indexed column and gathers their values*/
+        virtual void decode(TID begin, size_t count, T* out);
+        /*! \brief translates the TIDs to TIDs of the indexed column and gathers their values*/
+        virtual void gather(const PositionList& tids, T* out);
 
         virtual bool store(const std::string& path);
         virtual bool load(const std::string& path);
@@ -150,6 +154,21 @@ namespace CoGaDB {
         PositionListPtr new_tids(new PositionList(*tids_));
         return ColumnPtr(new LookupArray<T>(this->name_, this->db_type_, this->column_, new_tids));
     }
+
+    template<class T>
+    void LookupArray<T>::decode(TID begin, size_t count, T* out) {
+        PositionList tids(tids_->begin() + begin, tids_->begin() + begin + count);
+        column_->gather(tids, out);
+    }
+
+    template<class T>
+    void LookupArray<T>::gather(const PositionList& tids, T* out) {
+        PositionList translatedTids(tids.size());
+        for (size_t i = 0; i < tids.size(); i++) {
+            translatedTids[i] = (*tids_)[tids[i]];
+        }
+        column_->gather(translatedTids, out);
+    }
     /***************** relational operations on LookupArrays which return lookup tables *****************/
     //	template<class T>
     //	const std::vector<TID> LookupArray<T>::sort(const ComputeDevice comp_dev) const {
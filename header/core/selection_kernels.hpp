@@ -0,0 +1,92 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <cstddef>
+#include <string>
+
+namespace CoGaDB {
+
+    /*! \brief returns true, if value fulfills the predicate 'value comp value_for_comparison', PREFIX and SUBSTRING never match non string values*/
+    template<class T>
+    inline bool evaluatePredicate(const T& value, const T& value_for_comparison, const ValueComparator comp) {
+        return (comp == EQUAL && value == value_for_comparison)
+                || (comp == LESSER && value < value_for_comparison)
+                || (comp == GREATER && value > value_for_comparison);
+    }
+
+    /*! \brief returns true, if value fulfills the predicate 'value comp value_for_comparison', PREFIX matches values starting with value_for_comparison and SUBSTRING matches values containing it*/
+    inline bool evaluatePredicate(const std::string& value, const std::string& value_for_comparison, const ValueComparator comp) {
+        if (comp == PREFIX) {
+            return value.compare(0, value_for_comparison.size(), value_for_comparison) == 0;
+        } else if (comp == SUBSTRING) {
+            return value.find(value_for_comparison) != std::string::npos;
+        }
+        return (comp == EQUAL && value == value_for_comparison)
+                || (comp == LESSER && value < value_for_comparison)
+                || (comp == GREATER && value > value_for_comparison);
+    }
+
+    /*!
+     *  \brief     A ComparatorPredicate evaluates 'value comp value_for_comparison' with a comparator that is fixed at compile time.
+     *  \details   Since comp is a template parameter, evaluatePredicate() folds to a single comparison, which the compiler
+     *             translates without a branch for the built in types.
+     */
+    template<class T, ValueComparator comp>
+    struct ComparatorPredicate {
+
+        explicit ComparatorPredicate(const T& value_for_comparison) : value_for_comparison(value_for_comparison) {
+        }
+
+        bool operator()(const T& value) const {
+            return evaluatePredicate(value, value_for_comparison, comp);
+        }
+
+        T value_for_comparison;
+    };
+
+    /*! \brief a NotEqualPredicate matches all values unequal to value_for_comparison*/
+    template<class T>
+    struct NotEqualPredicate {
+
+        explicit NotEqualPredicate(const T& value_for_comparison) : value_for_comparison(value_for_comparison) {
+        }
+
+        bool operator()(const T& value) const {
+            return !(value == value_for_comparison);
+        }
+
+        T value_for_comparison;
+    };
+
+    /*! \brief a BetweenPredicate matches all values of the closed interval [lower, upper]*/
+    template<class T>
+    struct BetweenPredicate {
+
+        BetweenPredicate(const T& lower, const T& upper) : lower(lower), upper(upper) {
+        }
+
+        bool operator()(const T& value) const {
+            //both bounds are always evaluated, a bitwise and keeps the short circuit branch out of the kernel
+            return !(value < lower) & !(upper < value);
+        }
+
+        T lower;
+        T upper;
+    };
+
+    /*!
+     * \brief writes the TIDs of all values of the batch that fulfill the predicate to out and returns their number
+     * \details out has to have room for count TIDs. Every TID is stored unconditionally and the output position only advances
+     * for matches, so the loop contains no data dependent branch.
+     */
+    template<class T, class Predicate>
+    inline size_t selectBatch(const T* values, size_t count, TID firstTID, const Predicate& predicate, TID* out) {
+        size_t numberOfMatches = 0;
+        for (size_t i = 0; i < count; i++) {
+            out[numberOfMatches] = firstTID + i;
+            numberOfMatches += predicate(values[i]);
+        }
+        return numberOfMatches;
+    }
+
+}; //end namespace CogaDB
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <core/base_column.hpp>
+#include <core/thread_pool.hpp>
+#include <stdint.h>
+#include <cstring>
+#include <vector>
+
+namespace CoGaDB {
+
+    /*! \brief minimal number of values per task of a parallel sort*/
+    const size_t SORT_GRAIN_SIZE = 16384;
+    /*! \brief number of bits of the digit a pass of the radix sort distributes by*/
+    const unsigned int RADIX_BITS = 8;
+    const unsigned int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+    /*! \brief orders TIDs by the values they point to, a strict weak ordering for stable sorts*/
+    template<class T, SortOrder order>
+    struct PositionOrder {
+
+        explicit PositionOrder(const T* values) : values(values) {
+        }
+
+        bool operator()(TID first, TID second) const {
+            return order == ASCENDING ? values[first] < values[second] : values[second] < values[first];
+        }
+
+        const T* values;
+    };
+
+    /*! \brief maps an int to an unsigned key of equal order by flipping the sign bit*/
+    inline uint32_t getRadixKey(int value) {
+        return (uint32_t) value ^ 0x80000000u;
+    }
+
+    /*! \brief maps a float to an unsigned key of equal order, negative values get all bits flipped, positive ones the sign bit*/
+    inline uint32_t getRadixKey(float value) {
+        //-0.0 equals 0.0, so both get the same key and keep their order like in a stable comparison sort
+        if (value == 0.0f) {
+            value = 0.0f;
+        }
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof (bits));
+        return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    }
+
+    //counts the digits of the keys in [begin, end)
+    inline void countDigits(const uint32_t* keys, size_t begin, size_t end, unsigned int shift, size_t* histogram) {
+        std::fill(histogram, histogram + RADIX_BUCKETS, 0);
+        for (size_t i = begin; i < end; i++) {
+            histogram[(keys[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    //moves the keys and TIDs of [begin, end) to the positions of their digits, offsets holds the first position per digit
+    inline void scatterDigits(const uint32_t* keys, const TID* positions, size_t begin, size_t end, unsigned int shift, size_t* offsets, uint32_t* targetKeys, TID* targetPositions) {
+        for (size_t i = begin; i < end; i++) {
+            size_t target = offsets[(keys[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+            targetKeys[target] = keys[i];
+            targetPositions[target] = positions[i];
+        }
+    }
+
+    /*!
+     * \brief sorts the TIDs 0..numberOfValues-1 by their values with an LSD radix sort, equal values keep ascending TIDs
+     * \details Every pass distributes the keys by RADIX_BITS bits, passes whose digit is equal for all keys are skipped. With a pool,
+     * every chunk of the keys is counted and scattered by its own task; the offsets of a chunk start behind the same digits of all
+     * previous chunks, so the result is the same as the one of the serial sort.
+     */
+    template<class T>
+    void radixSortPositions(const T* values, size_t numberOfValues, SortOrder order, PositionList& positions, ThreadPool* pool) {
+        //descending keys are complemented, which keeps the sort stable
+        uint32_t mask = order == DESCENDING ? ~0u : 0u;
+        std::vector<uint32_t> keys(numberOfValues);
+        for (size_t i = 0; i < numberOfValues; i++) {
+            keys[i] = getRadixKey(values[i]) ^ mask;
+        }
+        positions.resize(numberOfValues);
+        for (TID i = 0; i < numberOfValues; i++) {
+            positions[i] = i;
+        }
+        if (numberOfValues == 0) {
+            return;
+        }
+
+        size_t numberOfChunks = pool == NULL ? 1 : std::max((size_t) 1, std::min((size_t) pool->getNumberOfThreads(), numberOfValues / SORT_GRAIN_SIZE));
+        std::vector<size_t> chunkBegins(numberOfChunks + 1);
+        for (size_t c = 0; c <= numberOfChunks; c++) {
+            chunkBegins[c] = numberOfValues * c / numberOfChunks;
+        }
+        /*vector<[CHUNK * RADIX_BUCKETS + DIGIT]>*/
+        std::vector<size_t> histograms(numberOfChunks * RADIX_BUCKETS);
+        std::vector<uint32_t> targetKeys(numberOfValues);
+        PositionList targetPositions(numberOfValues);
+
+        for (unsigned int shift = 0; shift < 32; shift += RADIX_BITS) {
+            if (numberOfChunks == 1) {
+                countDigits(&keys[0], 0, numberOfValues, shift, &histograms[0]);
+            } else {
+                std::vector<ThreadPool::Task> tasks;
+                for (size_t c = 0; c < numberOfChunks; c++) {
+                    tasks.push_back(boost::bind(&countDigits, &keys[0], chunkBegins[c], chunkBegins[c + 1], shift, &histograms[c * RADIX_BUCKETS]));
+                }
+                pool->execute(tasks);
+            }
+
+            //the offsets of digit d in chunk c follow all smaller digits and digit d of all previous chunks
+            size_t offset = 0;
+            bool skipPass = false;
+            for (unsigned int d = 0; d < RADIX_BUCKETS; d++) {
+                size_t count = 0;
+                for (size_t c = 0; c < numberOfChunks; c++) {
+                    size_t chunkCount = histograms[c * RADIX_BUCKETS + d];
+                    histograms[c * RADIX_BUCKETS + d] = offset;
+                    offset += chunkCount;
+                    count += chunkCount;
+                }
+                if (count == numberOfValues) {
+                    skipPass = true;
+                }
+            }
+            if (skipPass) {
+                continue;
+            }
+
+            if (numberOfChunks == 1) {
+                scatterDigits(&keys[0], &positions[0], 0, numberOfValues, shift, &histograms[0], &targetKeys[0], &targetPositions[0]);
+            } else {
+                std::vector<ThreadPool::Task> tasks;
+                for (size_t c = 0; c < numberOfChunks; c++) {
+                    tasks.push_back(boost::bind(&scatterDigits, &keys[0], &positions[0], chunkBegins[c], chunkBegins[c + 1], shift,
+                            &histograms[c * RADIX_BUCKETS], &targetKeys[0], &targetPositions[0]));
+                }
+                pool->execute(tasks);
+            }
+            keys.swap(targetKeys);
+            positions.swap(targetPositions);
+        }
+    }
+
+    /*!
+     * \brief sorts the TIDs 0..numberOfValues-1 by their values, equal values keep ascending TIDs
+     * \details Only the TIDs are moved, the values stay in place. Without a pool the TIDs are sorted by std::stable_sort, with a pool
+     * by the fork/join merge sort parallelStableSort(). int and float values use the radix sort instead.
+     */
+    template<class T>
+    void sortPositions(const T* values, size_t numberOfValues, SortOrder order, PositionList& positions, ThreadPool* pool) {
+        positions.resize(numberOfValues);
+        for (TID i = 0; i < numberOfValues; i++) {
+            positions[i] = i;
+        }
+        if (order == ASCENDING) {
+            if (pool == NULL) {
+                std::stable_sort(positions.begin(), positions.end(), PositionOrder<T, ASCENDING>(values));
+            } else {
+                parallelStableSort(positions.begin(), positions.end(), PositionOrder<T, ASCENDING>(values), pool, SORT_GRAIN_SIZE);
+            }
+        } else {
+            if (pool == NULL) {
+                std::stable_sort(positions.begin(), positions.end(), PositionOrder<T, DESCENDING>(values));
+            } else {
+                parallelStableSort(positions.begin(), positions.end(), PositionOrder<T, DESCENDING>(values), pool, SORT_GRAIN_SIZE);
+            }
+        }
+    }
+
+    inline void sortPositions(const int* values, size_t numberOfValues, SortOrder order, PositionList& positions, ThreadPool* pool) {
+        radixSortPositions(values, numberOfValues, order, positions, pool);
+    }
+
+    inline void sortPositions(const float* values, size_t numberOfValues, SortOrder order, PositionList& positions, ThreadPool* pool) {
+        radixSortPositions(values, numberOfValues, order, positions, pool);
+    }
+
+}; //end namespace CogaDB
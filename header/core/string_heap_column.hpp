@@ -0,0 +1,89 @@
+#pragma once
+
+#include <core/column_base_typed.hpp>
+#include <stdint.h>
+
+namespace CoGaDB {
+
+    /*!
+     *  \brief     This class represents a column of strings, which stores all characters in one contiguous heap.
+     *  \details   The characters of all values are concatenated in one byte buffer, the value with TID i occupies the bytes
+     *             [offsets[i], offsets[i+1]). No value has its own allocation, so scans and store/load touch three flat arrays
+     *             only, and store/load copy them as binary blobs. Optionally, the first four bytes of every value are kept inline
+     *             as a big endian integer, which decides most comparisons without touching the heap.
+     *             Since the values are not stored as std::string objects, operator[] returns a reference to a copy of the value,
+     *             writes have to use update().
+     */
+    class StringHeapColumn : public ColumnBaseTyped<std::string> {
+    public:
+        /***************** constructors and destructor *****************/
+        StringHeapColumn(const std::string& name, AttributeType db_type, bool useInlinePrefix = true);
+        virtual ~StringHeapColumn();
+
+        virtual bool insert(const boost::any& new_Value);
+        virtual bool insert(const std::string& new_value);
+        template <typename InputIterator>
+        bool insert(InputIterator first, InputIterator last);
+
+        virtual bool update(TID tid, const boost::any& new_value);
+        virtual bool update(PositionListPtr tid, const boost::any& new_value);
+
+        virtual bool remove(TID tid);
+        //assumes tid list is sorted ascending
+        virtual bool remove(PositionListPtr tid);
+        virtual bool clearContent();
+
+        virtual const boost::any get(TID tid);
+        //virtual const boost::any* const getRawData()=0;
+        virtual void print() const throw ();
+        virtual size_t size() const throw ();
+        virtual unsigned int getSizeinBytes() const throw ();
+
+        virtual const ColumnPtr copy() const;
+
+        /*! \brief copies the characters of the range from the heap, reusing the buffers of the strings in out*/
+        virtual void decode(TID begin, size_t count, std::string* out);
+
+        /*! \brief compares the inline prefixes first and reads the heap only if they are equal*/
+        virtual const PositionListPtr selection(const boost::any& value_for_comparison, const ValueComparator comp);
+
+        /*! \brief returns a pointer to the first character of the value with the given TID, the value is not null terminated*/
+        const char* getData(TID tid) const;
+        /*! \brief returns the number of characters of the value with the given TID*/
+        size_t getLength(TID tid) const;
+
+        virtual bool store(const std::string& path);
+        virtual bool load(const std::string& path);
+        virtual bool isMaterialized() const throw ();
+        virtual bool isCompressed() const throw ();
+
+        virtual std::string& operator[](const int index);
+
+    private:
+
+        static uint32_t computePrefix(const char* data, size_t length);
+        void rebuildPrefixes();
+        //returns <0, 0 or >0, if the value with the given TID is lesser, equal or greater than value
+        int compare(TID tid, const std::string& value, uint32_t valuePrefix) const;
+
+        bool useInlinePrefix;
+        /*vector<[CHARACTERS_OF_ALL_VALUES]>*/
+        std::vector<char> heap;
+        /*vector<[START_OF_VALUE]>, with one additional entry holding the end of the last value*/
+        std::vector<uint32_t> offsets;
+        /*vector<[FIRST_FOUR_BYTES_BIG_ENDIAN]>, empty if useInlinePrefix is false*/
+        std::vector<uint32_t> prefixes;
+
+    };
+
+    template <typename InputIterator>
+    bool StringHeapColumn::insert(InputIterator first, InputIterator last) {
+        for (InputIterator it = first; it != last; it++) {
+            if (!(this->insert(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}; //end namespace CogaDB
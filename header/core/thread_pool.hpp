@@ -0,0 +1,143 @@
+#pragma once
+
+#include <core/global_definitions.hpp>
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind/bind.hpp>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+namespace CoGaDB {
+
+    /*! \brief selects whether the generic operators run serially on the calling thread or on the global ThreadPool, SERIAL by default*/
+    void setParallelizationMode(ParallelizationMode mode);
+    /*! \brief returns the mode set by setParallelizationMode()*/
+    ParallelizationMode getParallelizationMode();
+
+    /*! \brief number of chunks per thread of a parallel operator, idle threads steal the chunks of threads with expensive ones*/
+    const unsigned int CHUNKS_PER_THREAD = 4;
+
+    class TaskGroup;
+
+    /*!
+     *  \brief     A ThreadPool is a work stealing scheduler, which runs tasks on a fixed set of worker threads that are created once
+     *             and reused by all operators.
+     *  \details   Every worker owns a deque of tasks. Tasks forked by a worker are pushed to the back of its own deque and the
+     *             worker takes them from the back again, so it continues with the most recently forked (and cache hot) task.
+     *             An idle worker steals from the front of the deques of the other workers, i.e., it takes the oldest and usually
+     *             largest piece of work. Tasks forked by other threads are queued in an additional deque, which all workers
+     *             steal from. Chunks that finish early (e.g., long runs of a run length encoded column) therefore never leave
+     *             a worker idle while other chunks are still queued.
+     *             Tasks are forked and joined with a TaskGroup and must not throw exceptions.
+     */
+    class ThreadPool {
+    public:
+        /* \brief a Task is a function without parameters and return value, its arguments are bound with boost::bind*/
+        typedef boost::function<void () > Task;
+
+        /***************** constructors and destructor *****************/
+        ThreadPool(unsigned int numberOfWorkers);
+        ~ThreadPool();
+
+        /*! \brief runs all tasks and returns after the last one has finished*/
+        void execute(const std::vector<Task>& tasks);
+        /*! \brief returns the number of threads that work on tasks, i.e., the workers and one waiting thread*/
+        unsigned int getNumberOfThreads() const;
+
+        /*! \brief returns the thread pool shared by all operators, which has one thread per hardware thread*/
+        static ThreadPool& getGlobalThreadPool();
+
+    private:
+        friend class TaskGroup;
+
+        /*a deque of tasks and their groups, the deque of a worker is only pushed and popped at the back by its owner*/
+        struct Worker {
+            Worker(ThreadPool* pool);
+
+            ThreadPool* pool;
+            boost::mutex mutex;
+            /*deque<[TASK, GROUP_OF_TASK]>*/
+            std::deque<std::pair<Task, TaskGroup*> > tasks;
+        };
+
+        //queues a task, on the deque of the calling worker or on the deque for tasks of other threads
+        void spawn(const Task& task, TaskGroup* group);
+        //runs one queued task and returns true, or returns false if no deque holds a task
+        bool runTask();
+        //pops the task from the back of the calling worker's deque or steals one from the front of another deque
+        bool takeTask(std::pair<Task, TaskGroup*>& task);
+        //runs queued tasks until the pool is destroyed
+        void work(Worker* worker);
+        //the workers are owned by their pool, so the thread local pointer to them must not delete them
+        static void keepWorker(Worker* worker);
+
+        /*the worker structure of the calling thread, NULL for threads that are no workers*/
+        static boost::thread_specific_ptr<Worker> currentWorker;
+
+        std::vector<Worker*> workers;
+        /*deque of the tasks forked by threads that are no workers*/
+        Worker external;
+        /*number of queued tasks, idle workers sleep while it is zero*/
+        size_t numberOfQueuedTasks;
+        boost::mutex mutex;
+        boost::condition_variable taskAvailable;
+        bool stopped;
+        boost::thread_group threads;
+
+        ThreadPool(const ThreadPool&);
+        ThreadPool& operator=(const ThreadPool&);
+    };
+
+    /*!
+     *  \brief     A TaskGroup forks tasks on a ThreadPool and joins them.
+     *  \details   run() queues a task, wait() returns after all tasks of the group have finished. The waiting thread runs queued
+     *             tasks in the meantime, so tasks may fork and join groups of their own. The destructor waits as well.
+     */
+    class TaskGroup {
+    public:
+        TaskGroup(ThreadPool& pool);
+        ~TaskGroup();
+
+        /*! \brief queues the task on the pool*/
+        void run(const ThreadPool::Task& task);
+        /*! \brief runs queued tasks until all tasks of the group have finished*/
+        void wait();
+
+    private:
+        friend class ThreadPool;
+
+        //called by the pool after a task of the group has finished
+        void finishTask();
+
+        ThreadPool& pool;
+        size_t unfinishedTasks;
+        boost::mutex mutex;
+        boost::condition_variable finished;
+
+        TaskGroup(const TaskGroup&);
+        TaskGroup& operator=(const TaskGroup&);
+    };
+
+    /*!
+     * \brief sorts [first, last) stably with a fork/join merge sort on the pool
+     * \details Both halves of a range are sorted concurrently and merged afterwards, ranges of at most grainSize elements are
+     * sorted by std::stable_sort. comp has to be a strict weak ordering.
+     */
+    template<class RandomAccessIterator, class Compare>
+    void parallelStableSort(RandomAccessIterator first, RandomAccessIterator last, Compare comp, ThreadPool* pool, size_t grainSize) {
+        if ((size_t) (last - first) <= grainSize) {
+            std::stable_sort(first, last, comp);
+            return;
+        }
+        RandomAccessIterator middle = first + (last - first) / 2;
+        {
+            TaskGroup group(*pool);
+            group.run(boost::bind(&parallelStableSort<RandomAccessIterator, Compare>, first, middle, comp, pool, grainSize));
+            parallelStableSort(middle, last, comp, pool, grainSize);
+            group.wait();
+        }
+        std::inplace_merge(first, middle, last, comp);
+    }
+
+}; //end namespace CogaDB
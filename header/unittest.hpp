@@ -15,11 +15,19 @@
 #define UNITTEST_HPP
 
 #include <string>
+#include <algorithm>
+#include <boost/scoped_array.hpp>
 #include <core/global_definitions.hpp>
 #include <core/base_column.hpp>
 #include <core/column_base_typed.hpp>
 #include <core/column.hpp>
 #include <core/compressed_column.hpp>
+#include <core/boolean_column.hpp>
+#include <core/string_heap_column.hpp>
+#include <compression/BitPacking.hpp>
+#include <compression/CascadedEncoding.hpp>
+#include <compression/DecimalEncoding.hpp>
+#include <compression/SparseEncoding.hpp>
 
 using namespace CoGaDB;
 
@@ -51,6 +59,22 @@ const std::string get_rand_value() {
 	return s;
 }
 
+template<>
+const bool get_rand_value() {
+	return rand() % 2;
+}
+
+//patterns for PREFIX and SUBSTRING predicates, short strings match often enough to be tested
+template<typename T>
+const T get_rand_pattern() {
+	return get_rand_value<T>();
+}
+
+template<>
+const std::string get_rand_pattern() {
+	return get_rand_value<std::string>().substr(0, 1 + rand() % 2);
+}
+
 template<class T>
 void fill_column(boost::shared_ptr<ColumnBaseTyped<T> > col, std::vector<T>& reference_data) {
 	for(unsigned int i = 0;i < reference_data.size(); i++){
@@ -116,6 +140,112 @@ bool test_column(boost::shared_ptr<ColumnBaseTyped<T> > col, boost::shared_ptr<C
 		return false;
 	}	
 	std::cout << "SUCCESS"<< std::endl;
+	/****** DECODE TEST ******/
+	{
+		std::cout << "DECODE TEST: decode ranges of the column into a buffer..."; // << std::endl;
+
+		boost::scoped_array<T> values(new T[reference_data.size()]);
+		for (unsigned int i = 0; i < 11; i++) {
+			//the last range is the complete column
+			TID begin = i < 10 ? rand() % reference_data.size() : 0;
+			size_t count = i < 10 ? rand() % (reference_data.size() - begin + 1) : reference_data.size();
+			col->decode(begin, count, values.get());
+			for (size_t j = 0; j < count; j++) {
+				if (values[j] != reference_data[begin + j]) {
+					std::cerr << "DECODE TEST FAILED! Position: '" << begin + j << "' Expected Value: '" << reference_data[begin + j]
+						<< "' Actual Value: '" << values[j] << "'" << std::endl;
+					return false;
+				}
+			}
+		}
+		std::cout << "SUCCESS"<< std::endl;
+	}
+	/****** CURSOR TEST ******/
+	{
+		std::cout << "CURSOR TEST: scan the column with a cursor and skip forward..."; // << std::endl;
+
+		typename ColumnBaseTyped<T>::ColumnCursorPtr cursor = col->createCursor();
+		if (!std::equal(reference_data.begin(), reference_data.end(), cursor->begin()) || cursor->hasNext()) {
+			std::cerr << "CURSOR TEST FAILED! The scan does not return the values of the column" << std::endl;
+			return false;
+		}
+		cursor = col->createCursor();
+		TID position = 0;
+		while (cursor->hasNext()) {
+			position += rand() % 600;
+			cursor->skipTo(position);
+			if (position >= reference_data.size()) {
+				break;
+			}
+			if (cursor->getPosition() != position || cursor->next() != reference_data[position]) {
+				std::cerr << "CURSOR TEST FAILED! Position: '" << position << "' Expected Value: '" << reference_data[position] << "'" << std::endl;
+				return false;
+			}
+			position++;
+		}
+		if (cursor->hasNext()) {
+			std::cerr << "CURSOR TEST FAILED! The cursor did not reach the end of the column" << std::endl;
+			return false;
+		}
+		std::cout << "SUCCESS"<< std::endl;
+	}
+	/****** GATHER TEST ******/
+	{
+		std::cout << "GATHER TEST: gather the values of sorted and unsorted TID lists..."; // << std::endl;
+
+		PositionList tids;
+		for (unsigned int i = 0; i < 200; i++) {
+			tids.push_back(rand() % reference_data.size());
+		}
+		for (unsigned int round = 0; round < 2; round++) {
+			//the first round gathers an unsorted list, the second one the same list sorted ascending
+			if (round == 1) {
+				std::sort(tids.begin(), tids.end());
+			}
+			boost::scoped_array<T> values(new T[tids.size()]);
+			col->gather(tids, values.get());
+			for (size_t i = 0; i < tids.size(); i++) {
+				if (values[i] != reference_data[tids[i]]) {
+					std::cerr << "GATHER TEST FAILED! Position: '" << tids[i] << "' Expected Value: '" << reference_data[tids[i]]
+						<< "' Actual Value: '" << values[i] << "'" << std::endl;
+					return false;
+				}
+			}
+		}
+		std::cout << "SUCCESS"<< std::endl;
+	}
+	/****** SORT TEST ******/
+	{
+		std::cout << "SORT TEST: sort the column ascending and descending..."; // << std::endl;
+
+		SortOrder orders[] = {ASCENDING, DESCENDING};
+		for (unsigned int i = 0; i < 2; i++) {
+			PositionListPtr tids = col->sort(orders[i]);
+			if (tids->size() != reference_data.size()) {
+				std::cerr << "SORT TEST FAILED! Expected '" << reference_data.size() << "' TIDs, got '" << tids->size() << "'" << std::endl;
+				return false;
+			}
+			//every neighbour has to be in order, equal values keep ascending TIDs, so no TID can occur twice
+			for (size_t j = 0; j < tids->size(); j++) {
+				if ((*tids)[j] >= reference_data.size()) {
+					std::cerr << "SORT TEST FAILED! Invalid TID: '" << (*tids)[j] << "'" << std::endl;
+					return false;
+				}
+				if (j == 0) {
+					continue;
+				}
+				const T& previous = reference_data[(*tids)[j - 1]];
+				const T& current = reference_data[(*tids)[j]];
+				bool before = orders[i] == ASCENDING ? previous < current : current < previous;
+				bool equal = !(previous < current) && !(current < previous);
+				if (!before && !(equal && (*tids)[j - 1] < (*tids)[j])) {
+					std::cerr << "SORT TEST FAILED! Position: '" << j << "' Order: '" << orders[i] << "'" << std::endl;
+					return false;
+				}
+			}
+		}
+		std::cout << "SUCCESS"<< std::endl;
+	}
 	/****** UPDATE TEST ******/
 	TID tid = rand() % 100;
 	T new_value = get_rand_value<T>();
@@ -189,6 +319,11 @@ AttributeType getAttributeType<std::string>(){
     return VARCHAR;
 }
 
+template< >
+AttributeType getAttributeType<bool>(){
+    return BOOLEAN;
+}
+
 template<typename ValueType>
 std::string getAttributeString(){
     return "unknown column";
@@ -208,6 +343,11 @@ std::string  getAttributeString<std::string>(){
     return "string column";
 }
 
+template<>
+std::string  getAttributeString<bool>(){
+    return "bool column";
+}
+
 template<template<typename> class ColumnType, typename ValueType>
 bool unittest() {
 	std::cout << "RUN Unittest for Column with BaseType ColumnBaseTyped<int> >" << std::endl;
@@ -221,6 +361,538 @@ bool unittest() {
 	return test_column<ValueType>(col_one, col_two, reference_data);
 }
 
+template<template<typename> class ColumnType, typename ValueType>
+bool selection_unittest() {
+	std::cout << "SELECTION TEST: compare selection results with an uncompressed column..."; // << std::endl;
+
+	boost::shared_ptr<ColumnType<ValueType> > col (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	boost::shared_ptr<Column<ValueType> > reference_col (new Column<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+
+	std::vector<ValueType> reference_data(1000);
+	fill_column<ValueType>(col, reference_data);
+	reference_col->insert(reference_data.begin(), reference_data.end());
+
+	ValueComparator comparators[] = {EQUAL, LESSER, GREATER, PREFIX, SUBSTRING};
+	for (unsigned int i = 0; i < 10; i++) {
+		for (unsigned int j = 0; j < 5; j++) {
+			ValueType value = comparators[j] == PREFIX || comparators[j] == SUBSTRING ? get_rand_pattern<ValueType>() : get_rand_value<ValueType>();
+			PositionListPtr tids = col->selection(value, comparators[j]);
+			PositionListPtr reference_tids = reference_col->selection(value, comparators[j]);
+			if (*tids != *reference_tids) {
+				std::cerr << "SELECTION TEST FAILED! Value: '" << value << "' Comparator: '" << comparators[j] << "'" << std::endl;
+				return false;
+			}
+		}
+	}
+	for (unsigned int i = 0; i < 10; i++) {
+		ValueType lower = get_rand_value<ValueType>();
+		ValueType upper = get_rand_value<ValueType>();
+		if (upper < lower) {
+			std::swap(lower, upper);
+		}
+		PositionListPtr between_tids = col->between_selection(lower, upper);
+		PositionListPtr not_equal_tids = col->not_equal_selection(lower);
+		PositionList reference_between_tids;
+		PositionList reference_not_equal_tids;
+		for (TID tid = 0; tid < reference_data.size(); tid++) {
+			if (!(reference_data[tid] < lower) && !(upper < reference_data[tid])) {
+				reference_between_tids.push_back(tid);
+			}
+			if (reference_data[tid] != lower) {
+				reference_not_equal_tids.push_back(tid);
+			}
+		}
+		if (*between_tids != reference_between_tids || *not_equal_tids != reference_not_equal_tids) {
+			std::cerr << "SELECTION TEST FAILED! Between: '" << lower << "' and '" << upper << "'" << std::endl;
+			return false;
+		}
+	}
+
+	//only columns with at least two batches are split into chunks
+	boost::shared_ptr<ColumnType<ValueType> > large_col (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	std::vector<ValueType> large_reference_data(5 * DECODE_BATCH_SIZE);
+	fill_column<ValueType>(large_col, large_reference_data);
+	for (unsigned int j = 0; j < 5; j++) {
+		ValueType value = comparators[j] == PREFIX || comparators[j] == SUBSTRING ? get_rand_pattern<ValueType>() : get_rand_value<ValueType>();
+		if (*large_col->parallel_selection(value, comparators[j], 4) != *large_col->selection(value, comparators[j])) {
+			std::cerr << "PARALLEL SELECTION TEST FAILED! Value: '" << value << "' Comparator: '" << comparators[j] << "'" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+//returns the pairs of a join result ordered by their TIDs, join algorithms differ in the order of their pairs
+std::vector<std::pair<TID, TID> > get_sorted_pairs(PositionListPairPtr join_tids) {
+	std::vector<std::pair<TID, TID> > pairs;
+	for (unsigned int i = 0; i < join_tids->first->size(); i++) {
+		pairs.push_back(std::make_pair((*join_tids->first)[i], (*join_tids->second)[i]));
+	}
+	std::sort(pairs.begin(), pairs.end());
+	return pairs;
+}
+
+template<template<typename> class ColumnType, typename ValueType>
+bool parallelization_unittest() {
+	std::cout << "PARALLELIZATION TEST: compare the parallel operators with the serial ones..."; // << std::endl;
+
+	boost::shared_ptr<ColumnType<ValueType> > col (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	boost::shared_ptr<Column<ValueType> > join_col (new Column<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	boost::shared_ptr<ColumnType<ValueType> > encoded_join_col (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+
+	std::vector<ValueType> reference_data(5 * DECODE_BATCH_SIZE);
+	fill_column<ValueType>(col, reference_data);
+	for (unsigned int i = 0; i < 100; i++) {
+		ValueType join_value = reference_data[rand() % reference_data.size()];
+		join_col->insert(join_value);
+		encoded_join_col->insert(join_value);
+	}
+
+	ValueType value = get_rand_value<ValueType>();
+	PositionListPtr results[2][3];
+	PositionListPairPtr join_results[2];
+	PositionListPairPtr theta_join_results[2];
+	ParallelizationMode modes[] = {SERIAL, PARALLEL};
+	for (unsigned int i = 0; i < 2; i++) {
+		setParallelizationMode(modes[i]);
+		results[i][0] = col->typed_selection(ComparatorPredicate<ValueType, LESSER>(value));
+		results[i][1] = col->ColumnBaseTyped<ValueType>::sort(ASCENDING);
+		results[i][2] = col->ColumnBaseTyped<ValueType>::sort(DESCENDING);
+		join_results[i] = join_col->hash_join(col);
+		theta_join_results[i] = col->theta_join(join_col, LESSER);
+	}
+	setParallelizationMode(SERIAL);
+
+	for (unsigned int j = 0; j < 3; j++) {
+		if (*results[0][j] != *results[1][j]) {
+			std::cerr << "PARALLELIZATION TEST FAILED! Operator: '" << j << "'" << std::endl;
+			return false;
+		}
+	}
+	if (*join_results[0]->first != *join_results[1]->first || *join_results[0]->second != *join_results[1]->second) {
+		std::cerr << "PARALLELIZATION TEST FAILED! Hash join results differ" << std::endl;
+		return false;
+	}
+	if (*theta_join_results[0]->first != *theta_join_results[1]->first || *theta_join_results[0]->second != *theta_join_results[1]->second) {
+		std::cerr << "PARALLELIZATION TEST FAILED! Theta join results differ" << std::endl;
+		return false;
+	}
+	if (get_sorted_pairs(join_col->nested_loop_join(col)) != get_sorted_pairs(join_results[0])) {
+		std::cerr << "PARALLELIZATION TEST FAILED! Nested loop join and hash join find different pairs" << std::endl;
+		return false;
+	}
+	if (get_sorted_pairs(join_col->sort_merge_join(col)) != get_sorted_pairs(join_results[0])) {
+		std::cerr << "PARALLELIZATION TEST FAILED! Sort merge join and hash join find different pairs" << std::endl;
+		return false;
+	}
+	//two columns of the same encoding may be joined in the compressed domain
+	if (get_sorted_pairs(encoded_join_col->join(col)) != get_sorted_pairs(join_results[0]) || encoded_join_col->getLastJoinAlgorithm() == AUTO) {
+		std::cerr << "PARALLELIZATION TEST FAILED! Join with automatically chosen algorithm and hash join find different pairs" << std::endl;
+		return false;
+	}
+	//the semi join returns every TID of col that the hash join pairs with a TID of join_col
+	PositionList semi_join_reference(*join_results[0]->second);
+	std::sort(semi_join_reference.begin(), semi_join_reference.end());
+	semi_join_reference.erase(std::unique(semi_join_reference.begin(), semi_join_reference.end()), semi_join_reference.end());
+	if (*col->semi_join(join_col) != semi_join_reference) {
+		std::cerr << "PARALLELIZATION TEST FAILED! Semi join and hash join find different TIDs" << std::endl;
+		return false;
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+template<template<typename> class ColumnType, typename ValueType>
+bool column_algebra_unittest() {
+	std::cout << "COLUMN ALGEBRA TEST: compare fused expressions and column operations with the reference data..."; // << std::endl;
+
+	boost::shared_ptr<ColumnType<ValueType> > a (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	boost::shared_ptr<ColumnType<ValueType> > b (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	boost::shared_ptr<ColumnType<ValueType> > c (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+
+	std::vector<ValueType> a_data(5 * DECODE_BATCH_SIZE);
+	std::vector<ValueType> b_data(a_data.size());
+	std::vector<ValueType> c_data(a_data.size());
+	fill_column<ValueType>(a, a_data);
+	fill_column<ValueType>(b, b_data);
+	fill_column<ValueType>(c, c_data);
+
+	std::vector<ValueType> reference_data(a_data.size());
+	for (unsigned int i = 0; i < reference_data.size(); i++) {
+		reference_data[i] = (a_data[i] + b_data[i]) * c_data[i] - 1;
+	}
+	//the expression is written into a new column in both modes
+	ParallelizationMode modes[] = {SERIAL, PARALLEL};
+	for (unsigned int i = 0; i < 2; i++) {
+		setParallelizationMode(modes[i]);
+		boost::shared_ptr<ColumnBaseTyped<ValueType> > result (new Column<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+		if (!result->assign((operand(*a) + operand(*b)) * operand(*c) - 1) || result->size() != reference_data.size() || !equals(reference_data, result)) {
+			std::cerr << "COLUMN ALGEBRA TEST FAILED! Fused expression in mode '" << modes[i] << "'" << std::endl;
+			setParallelizationMode(SERIAL);
+			return false;
+		}
+	}
+	setParallelizationMode(SERIAL);
+
+	//the column operations modify the column in place
+	for (unsigned int i = 0; i < a_data.size(); i++) {
+		a_data[i] = (a_data[i] + b_data[i]) * 2;
+	}
+	if (!a->add(ColumnPtr(b)) || !a->multiply(boost::any(ValueType(2))) || !equals<ValueType>(a_data, a)) {
+		std::cerr << "COLUMN ALGEBRA TEST FAILED! Column operations" << std::endl;
+		return false;
+	}
+	//encodings transform their distinct values or runs, after the multiplication with zero all values are equal
+	for (unsigned int i = 0; i < a_data.size(); i++) {
+		a_data[i] = (a_data[i] - 3) * 0 + 5;
+	}
+	if (!a->minus(boost::any(ValueType(3))) || !a->multiply(boost::any(ValueType(0))) || !a->add(boost::any(ValueType(5)))
+			|| !equals<ValueType>(a_data, a) || a->getNumberOfDistinctValues() != 1) {
+		std::cerr << "COLUMN ALGEBRA TEST FAILED! Operations with a constant" << std::endl;
+		return false;
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+//returns ascending values with a few descending steps, so the column has to leave its sorted path
+std::vector<int> get_unsorted_data() {
+	std::vector<int> data(5 * BitPacking::BLOCK_SIZE + 17);
+	for (unsigned int i = 0; i < data.size(); i++) {
+		data[i] = i < 2 * BitPacking::BLOCK_SIZE ? int(i * 3) : int(i * 3) - 1000 * int(i % 37 == 0) + rand() % 5;
+	}
+	return data;
+}
+
+//returns small values with large exceptions at the first and last positions of blocks and in the uncompressed tail
+std::vector<int> get_exception_data() {
+	std::vector<int> data(5 * BitPacking::BLOCK_SIZE + 17);
+	for (unsigned int i = 0; i < data.size(); i++) {
+		bool exception = i % BitPacking::BLOCK_SIZE == 0 || i % BitPacking::BLOCK_SIZE == BitPacking::BLOCK_SIZE - 1 || rand() % 20 == 0;
+		data[i] = exception ? 1000000 + rand() % 1000 : rand() % 8;
+	}
+	return data;
+}
+
+//returns small values with a large negative outlier in every block, so the frame of a block is not its minimum
+std::vector<int> get_low_outlier_data() {
+	std::vector<int> data(5 * BitPacking::BLOCK_SIZE + 17);
+	for (unsigned int i = 0; i < data.size(); i++) {
+		data[i] = 1000 + rand() % 8;
+	}
+	for (unsigned int i = 0; i + BitPacking::BLOCK_SIZE <= data.size(); i += BitPacking::BLOCK_SIZE) {
+		data[i + rand() % BitPacking::BLOCK_SIZE] = -1000000 - rand() % 1000;
+	}
+	return data;
+}
+
+//returns values with two decimal places mixed with values that do not survive the scaling to integers
+std::vector<float> get_unscalable_data() {
+	std::vector<float> data(5 * BitPacking::BLOCK_SIZE + 17);
+	float unscalable[] = {1.0f / 3, 3.14159265f, 1e30f, -2.5e-12f};
+	for (unsigned int i = 0; i < data.size(); i++) {
+		bool exception = i % BitPacking::BLOCK_SIZE == BitPacking::BLOCK_SIZE - 1 || rand() % 10 == 0;
+		data[i] = exception ? unscalable[rand() % 4] : float(rand() % 10000) / 100;
+	}
+	return data;
+}
+
+//fills col with reference_data and compares decode, gather and selection with an uncompressed column
+template<typename ValueType>
+bool compare_with_reference(boost::shared_ptr<ColumnBaseTyped<ValueType> > col, const std::vector<ValueType>& reference_data) {
+	boost::shared_ptr<Column<ValueType> > reference_col (new Column<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	for (unsigned int i = 0; i < reference_data.size(); i++) {
+		col->insert(reference_data[i]);
+	}
+	reference_col->insert(reference_data.begin(), reference_data.end());
+
+	if (col->isSorted() != reference_col->isSorted()) {
+		std::cerr << "REFERENCE TEST FAILED! The column does not know whether it is sorted" << std::endl;
+		return false;
+	}
+	//ranges start and end around the block boundaries, values behind a range must not be written
+	const ValueType guard = ValueType(12345);
+	for (TID begin = 0; begin < reference_data.size(); begin += BitPacking::BLOCK_SIZE / 2 - 1) {
+		size_t count = std::min((size_t) (rand() % (3 * BitPacking::BLOCK_SIZE)), reference_data.size() - begin);
+		std::vector<ValueType> values(count + BitPacking::BLOCK_SIZE, guard);
+		col->decode(begin, count, &values[0]);
+		if (!std::equal(values.begin(), values.begin() + count, reference_data.begin() + begin)
+				|| std::count(values.begin() + count, values.end(), guard) != (long) BitPacking::BLOCK_SIZE) {
+			std::cerr << "REFERENCE TEST FAILED! Decode of '" << count << "' values at '" << begin << "'" << std::endl;
+			return false;
+		}
+	}
+	PositionList tids;
+	for (unsigned int i = 0; i < 100; i++) {
+		tids.push_back(rand() % reference_data.size());
+	}
+	for (unsigned int round = 0; round < 2; round++) {
+		if (round == 1) {
+			std::sort(tids.begin(), tids.end());
+		}
+		std::vector<ValueType> values(tids.size());
+		col->gather(tids, &values[0]);
+		for (size_t i = 0; i < tids.size(); i++) {
+			if (values[i] != reference_data[tids[i]]) {
+				std::cerr << "REFERENCE TEST FAILED! Gather of TID '" << tids[i] << "'" << std::endl;
+				return false;
+			}
+		}
+	}
+	//the comparison values are taken from the data, so the predicates match regular values and fallback values
+	ValueComparator comparators[] = {EQUAL, LESSER, GREATER};
+	for (unsigned int i = 0; i < 20; i++) {
+		ValueType value = reference_data[rand() % reference_data.size()];
+		for (unsigned int j = 0; j < 3; j++) {
+			if (*col->selection(value, comparators[j]) != *reference_col->selection(value, comparators[j])) {
+				std::cerr << "REFERENCE TEST FAILED! Value: '" << value << "' Comparator: '" << comparators[j] << "'" << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+template<template<typename> class ColumnType, typename ValueType>
+bool fallback_unittest(const std::vector<ValueType>& reference_data) {
+	std::cout << "FALLBACK TEST: decode, gather and filter data that leaves the fast path of the encoding..."; // << std::endl;
+
+	boost::shared_ptr<ColumnType<ValueType> > col (new ColumnType<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	if (!compare_with_reference<ValueType>(col, reference_data)) {
+		return false;
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+bool decimal_sum_unittest() {
+	std::cout << "DECIMAL SUM TEST: compare the sum on the scaled integers with a sum of the decoded values..."; // << std::endl;
+
+	//the first column holds only scalable values, the second one exceptions as well, but none that would hide the others in the sum
+	std::vector<float> data[2];
+	data[0].resize(5 * BitPacking::BLOCK_SIZE + 17);
+	for (unsigned int i = 0; i < data[0].size(); i++) {
+		data[0][i] = get_rand_value<float>();
+	}
+	data[1] = get_unscalable_data();
+	for (unsigned int i = 0; i < data[1].size(); i++) {
+		if (std::fabs(data[1][i]) > 1e6) {
+			data[1][i] = 1.0f / 7;
+		}
+	}
+	for (unsigned int i = 0; i < 2; i++) {
+		boost::shared_ptr<DecimalEncoding<float> > col (new DecimalEncoding<float>(getAttributeString<float>(), FLOAT));
+		col->insert(data[i].begin(), data[i].end());
+		double reference_sum = 0;
+		double magnitude = 0;
+		for (unsigned int j = 0; j < data[i].size(); j++) {
+			reference_sum += data[i][j];
+			magnitude += std::fabs(data[i][j]);
+		}
+		//the scaled sum is exact for the decimal values, which differ from their float representation in the last bits
+		if (std::fabs(col->sum() - reference_sum) > 1e-6 * magnitude) {
+			std::cerr << "DECIMAL SUM TEST FAILED! Expected '" << reference_sum << "' Actual '" << col->sum() << "'" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+bool cascaded_unittest(CodeEncoding codeEncoding) {
+	std::cout << "RUN Unittest for CascadedEncoding with code encoding '" << codeEncoding << "'" << std::endl;
+
+	boost::shared_ptr<CascadedEncoding<int> > col (new CascadedEncoding<int>(getAttributeString<int>(), INT, codeEncoding));
+	boost::shared_ptr<CascadedEncoding<int> > col_new (new CascadedEncoding<int>(getAttributeString<int>(), INT, codeEncoding));
+	std::vector<int> reference_data(1000);
+	fill_column<int>(col, reference_data);
+	if (!test_column<int>(col, col_new, reference_data)) {
+		return false;
+	}
+
+	std::cout << "CODE RANGE TEST: filter columns whose codes are ordered like their values..."; // << std::endl;
+	//a sorted load orders the codes like the values, so the predicates select prefixes, suffixes or single codes
+	std::vector<int> sorted_data(5 * BitPacking::BLOCK_SIZE + 17);
+	for (unsigned int i = 0; i < sorted_data.size(); i++) {
+		sorted_data[i] = i / 3;
+	}
+	//a large first value gets code 0, so LESSER selects a range in the middle of the code domain
+	std::vector<int> shifted_data(sorted_data);
+	shifted_data.insert(shifted_data.begin(), 1000000);
+	boost::shared_ptr<CascadedEncoding<int> > sorted_col (new CascadedEncoding<int>(getAttributeString<int>(), INT, codeEncoding));
+	boost::shared_ptr<CascadedEncoding<int> > shifted_col (new CascadedEncoding<int>(getAttributeString<int>(), INT, codeEncoding));
+	if (!compare_with_reference<int>(sorted_col, sorted_data) || !compare_with_reference<int>(shifted_col, shifted_data)) {
+		return false;
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+//compares the selections of col for the given values with the ones of an uncompressed column
+template<typename ValueType>
+bool selections_equal(boost::shared_ptr<ColumnBaseTyped<ValueType> > col, const std::vector<ValueType>& reference_data, const std::vector<ValueType>& values) {
+	boost::shared_ptr<Column<ValueType> > reference_col (new Column<ValueType>(getAttributeString<ValueType>(),getAttributeType<ValueType>()));
+	reference_col->insert(reference_data.begin(), reference_data.end());
+	ValueComparator comparators[] = {EQUAL, LESSER, GREATER};
+	for (unsigned int i = 0; i < values.size(); i++) {
+		for (unsigned int j = 0; j < 3; j++) {
+			if (*col->selection(values[i], comparators[j]) != *reference_col->selection(values[i], comparators[j])) {
+				std::cerr << "SELECTION TEST FAILED! Value: '" << values[i] << "' Comparator: '" << comparators[j] << "'" << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool sparse_unittest() {
+	std::cout << "SPARSE TEST: filter, remove, store and load a column that mostly holds one value..."; // << std::endl;
+
+	boost::shared_ptr<SparseEncoding<int> > col (new SparseEncoding<int>(getAttributeString<int>(), INT));
+	std::vector<int> reference_data;
+	for (unsigned int i = 0; i < 4000; i++) {
+		//the first value is rare and the dominant value drifts from 7 to 42, so the default value is chosen again twice
+		int value = i == 0 || rand() % 20 == 0 ? rand() % 100 : (i < 1000 ? 7 : 42);
+		if (i == 0) {
+			value = 5;
+		}
+		reference_data.push_back(value);
+		col->insert(value);
+		if (i == 999 && (col->getDefaultValue() != 7 || col->getNumberOfExceptions() * 5 > col->size())) {
+			std::cerr << "SPARSE TEST FAILED! The most frequent value did not replace the first value as default value" << std::endl;
+			return false;
+		}
+	}
+	if (col->getDefaultValue() != 42 || col->getNumberOfExceptions() * 2 > col->size() || !equals<int>(reference_data, col)) {
+		std::cerr << "SPARSE TEST FAILED! The default value did not follow the data" << std::endl;
+		return false;
+	}
+
+	//the predicates that match the default value are evaluated as complement of the exceptions
+	std::vector<int> values;
+	for (int value = 6; value <= 8; value++) {
+		values.push_back(value);
+		values.push_back(value + 35);
+	}
+	if (!selections_equal<int>(col, reference_data, values)) {
+		return false;
+	}
+
+	//every seventh row is removed, which removes default rows and exceptions
+	PositionListPtr tids(new PositionList());
+	std::vector<int> remaining_data;
+	for (TID tid = 0; tid < reference_data.size(); tid++) {
+		if (tid % 7 == 0) {
+			tids->push_back(tid);
+		} else {
+			remaining_data.push_back(reference_data[tid]);
+		}
+	}
+	if (!col->remove(tids) || col->size() != remaining_data.size() || !equals<int>(remaining_data, col)
+			|| !selections_equal<int>(col, remaining_data, values)) {
+		std::cerr << "SPARSE TEST FAILED! Remove of a TID list" << std::endl;
+		return false;
+	}
+
+	col->store("data/");
+	boost::shared_ptr<SparseEncoding<int> > col_new (new SparseEncoding<int>(getAttributeString<int>(), INT));
+	col_new->load("data/");
+	if (col_new->size() != remaining_data.size() || col_new->getDefaultValue() != col->getDefaultValue()
+			|| col_new->getNumberOfExceptions() != col->getNumberOfExceptions() || !equals<int>(remaining_data, col_new)
+			|| !selections_equal<int>(col_new, remaining_data, values)) {
+		std::cerr << "SPARSE TEST FAILED! Store and load" << std::endl;
+		return false;
+	}
+	std::cout << "SUCCESS"<< std::endl;
+	return true;
+}
+
+bool boolean_column_unittest() {
+	std::cout << "RUN Unittest for BooleanColumn" << std::endl;
+
+	boost::shared_ptr<BooleanColumn> col (new BooleanColumn(getAttributeString<bool>(), getAttributeType<bool>()));
+	boost::shared_ptr<BooleanColumn> col_new (new BooleanColumn(getAttributeString<bool>(), getAttributeType<bool>()));
+
+	std::vector<bool> reference_data(1000);
+	for (unsigned int i = 0; i < reference_data.size(); i++) {
+		bool value = get_rand_value<bool>();
+		reference_data[i] = value;
+		col->insert(value);
+	}
+
+	std::cout << "COUNT TEST: compare count with the reference data..."; // << std::endl;
+	size_t number_of_true_values = std::count(reference_data.begin(), reference_data.end(), true);
+	if (col->count(true) != number_of_true_values || col->count(false) != reference_data.size() - number_of_true_values) {
+		std::cerr << "COUNT TEST FAILED!" << std::endl;
+		return false;
+	}
+	std::cout << "SUCCESS"<< std::endl;
+
+	std::cout << "SELECTION TEST: compare selection results with the reference data..."; // << std::endl;
+	ValueComparator comparators[] = {EQUAL, LESSER, GREATER};
+	for (unsigned int i = 0; i < 2; i++) {
+		bool value = (i == 1);
+		for (unsigned int j = 0; j < 3; j++) {
+			PositionListPtr tids = col->selection(value, comparators[j]);
+			PositionList reference_tids;
+			for (TID tid = 0; tid < reference_data.size(); tid++) {
+				bool match = (comparators[j] == EQUAL && reference_data[tid] == value)
+						|| (comparators[j] == LESSER && reference_data[tid] < value)
+						|| (comparators[j] == GREATER && reference_data[tid] > value);
+				if (match) {
+					reference_tids.push_back(tid);
+				}
+			}
+			if (*tids != reference_tids) {
+				std::cerr << "SELECTION TEST FAILED! Value: '" << value << "' Comparator: '" << comparators[j] << "'" << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "SUCCESS"<< std::endl;
+
+	return test_column<bool>(col, col_new, reference_data);
+}
+
+bool string_heap_column_unittest(bool use_inline_prefix) {
+	std::cout << "RUN Unittest for StringHeapColumn" << (use_inline_prefix ? " with" : " without") << " inline prefixes" << std::endl;
+
+	boost::shared_ptr<StringHeapColumn> col (new StringHeapColumn(getAttributeString<std::string>(), getAttributeType<std::string>(), use_inline_prefix));
+	boost::shared_ptr<StringHeapColumn> col_new (new StringHeapColumn(getAttributeString<std::string>(), getAttributeType<std::string>(), use_inline_prefix));
+	boost::shared_ptr<Column<std::string> > reference_col (new Column<std::string>(getAttributeString<std::string>(), getAttributeType<std::string>()));
+
+	std::vector<std::string> reference_data(1000);
+	fill_column<std::string>(col, reference_data);
+	//values sharing their first four characters and empty values have to be decided by the heap
+	col->update(1, std::string(reference_data[0], 0, 4));
+	col->update(2, std::string());
+	reference_data[1] = std::string(reference_data[0], 0, 4);
+	reference_data[2] = std::string();
+	reference_col->insert(reference_data.begin(), reference_data.end());
+
+	std::cout << "SELECTION TEST: compare selection results with an uncompressed column..."; // << std::endl;
+	ValueComparator comparators[] = {EQUAL, LESSER, GREATER, PREFIX, SUBSTRING};
+	for (unsigned int i = 0; i < 13; i++) {
+		for (unsigned int j = 0; j < 5; j++) {
+			std::string value = i < 3 ? reference_data[i] : get_rand_value<std::string>();
+			if (comparators[j] == PREFIX || comparators[j] == SUBSTRING) {
+				//patterns longer than the inline prefix are tested as well
+				value = i < 3 ? reference_data[i].substr(0, 5) : get_rand_pattern<std::string>();
+			}
+			PositionListPtr tids = col->selection(value, comparators[j]);
+			PositionListPtr reference_tids = reference_col->selection(value, comparators[j]);
+			if (*tids != *reference_tids) {
+				std::cerr << "SELECTION TEST FAILED! Value: '" << value << "' Comparator: '" << comparators[j] << "'" << std::endl;
+				return false;
+			}
+		}
+	}
+	std::cout << "SUCCESS"<< std::endl;
+
+	return test_column<std::string>(col, col_new, reference_data);
+}
+
 
 
 
@@ -36,7 +36,10 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 # Object Files
 OBJECTFILES= \
 	${OBJECTDIR}/source/base_column.o \
-	${OBJECTDIR}/source/main.o
+	${OBJECTDIR}/source/boolean_column.o \
+	${OBJECTDIR}/source/main.o \
+	${OBJECTDIR}/source/string_heap_column.o \
+	${OBJECTDIR}/source/thread_pool.o
 
 
 # C Compiler Flags
@@ -61,18 +64,33 @@ LDLIBSOPTIONS=
 
 ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/db2task: ${OBJECTFILES}
 	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
-	${LINK.cc} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/db2task ${OBJECTFILES} ${LDLIBSOPTIONS} -lboost_serialization
+	${LINK.cc} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/db2task ${OBJECTFILES} ${LDLIBSOPTIONS} -lboost_serialization -lboost_thread -lboost_system
 
 ${OBJECTDIR}/source/base_column.o: source/base_column.cpp
 	${MKDIR} -p ${OBJECTDIR}/source
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Iheader -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/source/base_column.o source/base_column.cpp
 
+${OBJECTDIR}/source/boolean_column.o: source/boolean_column.cpp
+	${MKDIR} -p ${OBJECTDIR}/source
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Iheader -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/source/boolean_column.o source/boolean_column.cpp
+
 ${OBJECTDIR}/source/main.o: source/main.cpp
 	${MKDIR} -p ${OBJECTDIR}/source
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Iheader -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/source/main.o source/main.cpp
 
+${OBJECTDIR}/source/string_heap_column.o: source/string_heap_column.cpp
+	${MKDIR} -p ${OBJECTDIR}/source
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Iheader -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/source/string_heap_column.o source/string_heap_column.cpp
+
+${OBJECTDIR}/source/thread_pool.o: source/thread_pool.cpp
+	${MKDIR} -p ${OBJECTDIR}/source
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Iheader -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/source/thread_pool.o source/thread_pool.cpp
+
 # Subprojects
 .build-subprojects:
 
@@ -1,13 +1,14 @@
 
 #include <core/base_column.hpp>
 #include <core/column.hpp>
+#include <core/boolean_column.hpp>
 #include <iostream>
 
 using namespace std;
 
 namespace CoGaDB {
 
-    ColumnBase::ColumnBase(const std::string& name, AttributeType db_type) : name_(name), db_type_(db_type) {
+    ColumnBase::ColumnBase(const std::string& name, AttributeType db_type) : name_(name), db_type_(db_type), last_join_algorithm_(AUTO) {
 
     }
 
@@ -22,6 +23,27 @@ namespace CoGaDB {
         return name_;
     }
 
+    const PositionListPairPtr ColumnBase::join(ColumnPtr join_column, JoinAlgorithm algorithm) {
+        if (algorithm == AUTO) {
+            algorithm = this->chooseJoinAlgorithm(join_column);
+        }
+        last_join_algorithm_ = algorithm;
+
+        if (algorithm == SORT_MERGE_JOIN) {
+            if (!quiet) cout << "Using Sort Merge Join..." << endl;
+            return this->sort_merge_join(join_column);
+        } else if (algorithm == NESTED_LOOP_JOIN) {
+            if (!quiet) cout << "Using Nested Loop Join..." << endl;
+            return this->nested_loop_join(join_column);
+        }
+        if (!quiet) cout << "Using Hash Join..." << endl;
+        return this->hash_join(join_column);
+    }
+
+    JoinAlgorithm ColumnBase::getLastJoinAlgorithm() const throw () {
+        return last_join_algorithm_;
+    }
+
     const ColumnPtr createColumn(AttributeType type, const std::string& name) {
 
         ColumnPtr ptr;
@@ -32,9 +54,7 @@ namespace CoGaDB {
         } else if (type == VARCHAR) {
             ptr = ColumnPtr(new Column<string>(name, VARCHAR));
         } else if (type == BOOLEAN) {
-            //ptr=ColumnPtr(new Column<bool>(name,BOOLEAN));
-            cout << "Fatal Error! invalid AttributeType: " << type << " for Column: " << name
-                    << " Note: bool is currently not supported, will be added again in the future!" << endl;
+            ptr = ColumnPtr(new BooleanColumn(name, BOOLEAN));
         } else {
             cout << "Fatal Error! invalid AttributeType: " << type << " for Column: " << name << endl;
         }
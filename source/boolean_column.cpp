@@ -0,0 +1,268 @@
+#include <core/boolean_column.hpp>
+#include <iostream>
+#include <fstream>
+
+using namespace std;
+
+namespace CoGaDB {
+
+    BooleanColumn::BooleanColumn(const std::string& name, AttributeType db_type) : ColumnBaseTyped<bool>(name, db_type), words(), numberOfValues(0) {
+
+    }
+
+    BooleanColumn::~BooleanColumn() {
+
+    }
+
+    bool BooleanColumn::getValue(TID tid) const {
+        return (words[tid >> 6] >> (tid & 63)) & 1;
+    }
+
+    void BooleanColumn::setValue(TID tid, bool value) {
+        uint64_t bit = uint64_t(1) << (tid & 63);
+        words[tid >> 6] = (words[tid >> 6] & ~bit) | (uint64_t(value) << (tid & 63));
+    }
+
+    bool BooleanColumn::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (bool) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<bool>(newValue));
+    }
+
+    bool BooleanColumn::insert(const bool& newValue) {
+        if (numberOfValues % 64 == 0) {
+            words.push_back(0);
+        }
+        setValue(numberOfValues, newValue);
+        numberOfValues++;
+        return true;
+    }
+
+    bool BooleanColumn::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (bool) != newValue.type() || tid >= numberOfValues) {
+            return false;
+        }
+        setValue(tid, boost::any_cast<bool>(newValue));
+        return true;
+    }
+
+    bool BooleanColumn::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (bool) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool BooleanColumn::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= numberOfValues) {
+            return false;
+        }
+
+        //the bits above tid move down by one, each word takes the lowest bit of the next word as its highest bit
+        uint64_t word = tid >> 6;
+        uint64_t lowerBits = (uint64_t(1) << (tid & 63)) - 1;
+        words[word] = (words[word] & lowerBits) | ((words[word] >> 1) & ~lowerBits);
+        for (uint64_t i = word; i + 1 < words.size(); i++) {
+            if (i != word) {
+                words[i] >>= 1;
+            }
+            words[i] |= (words[i + 1] & 1) << 63;
+        }
+        if (word + 1 < words.size()) {
+            words.back() >>= 1;
+        }
+
+        numberOfValues--;
+        if (numberOfValues % 64 == 0) {
+            words.pop_back();
+        }
+        return true;
+    }
+
+    bool BooleanColumn::remove(PositionListPtr tids) {
+        //check for empty tid list or empty column
+        if (!tids || tids->empty() || numberOfValues == 0) {
+            return false;
+        }
+        if (tids->back() >= numberOfValues) {
+            return false;
+        }
+
+        //copy all remaining values from the first removed tid on to their new positions
+        TID target = tids->front();
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = tids->front(); i < numberOfValues; i++) {
+            if (it != tids->end() && *it == i) {
+                ++it;
+            } else {
+                setValue(target++, getValue(i));
+            }
+        }
+
+        //clear the bits behind the last value
+        numberOfValues = target;
+        words.resize((numberOfValues + 63) / 64);
+        if (numberOfValues % 64 != 0) {
+            words.back() &= (uint64_t(1) << (numberOfValues % 64)) - 1;
+        }
+        return true;
+    }
+
+    bool BooleanColumn::clearContent() {
+        words.clear();
+        numberOfValues = 0;
+        return true;
+    }
+
+    const boost::any BooleanColumn::get(TID tid) {
+        if (tid < numberOfValues) {
+            return boost::any(getValue(tid));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    void BooleanColumn::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        for (TID i = 0; i < numberOfValues; i++) {
+            std::cout << "| " << getValue(i) << " |" << std::endl;
+        }
+    }
+
+    size_t BooleanColumn::size() const throw () {
+        return numberOfValues;
+    }
+
+    const ColumnPtr BooleanColumn::copy() const {
+        return ColumnPtr(new BooleanColumn(*this));
+    }
+
+    void BooleanColumn::decode(TID begin, size_t count, bool* out) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = getValue(begin + i);
+        }
+    }
+
+    const BitmapPtr BooleanColumn::selectionBitmap(bool value, const ValueComparator comp) const {
+        //a value matches, if it is equal to value (EQUAL), false while value is true (LESSER) or true while value is false (GREATER)
+        bool matchTrue = (comp == EQUAL && value) || (comp == GREATER && !value);
+        bool matchFalse = (comp == EQUAL && !value) || (comp == LESSER && value);
+
+        uint64_t trueMask = matchTrue ? ~uint64_t(0) : 0;
+        uint64_t falseMask = matchFalse ? ~uint64_t(0) : 0;
+        BitmapPtr bitmap(new Bitmap(words.size()));
+        for (uint64_t i = 0; i < words.size(); i++) {
+            (*bitmap)[i] = (words[i] & trueMask) | (~words[i] & falseMask);
+        }
+        if (numberOfValues % 64 != 0) {
+            bitmap->back() &= (uint64_t(1) << (numberOfValues % 64)) - 1;
+        }
+        return bitmap;
+    }
+
+    const PositionListPtr BooleanColumn::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (bool)) {
+            return ColumnBaseTyped<bool>::selection(value_for_comparison, comp);
+        }
+        BitmapPtr bitmap = selectionBitmap(boost::any_cast<bool>(value_for_comparison), comp);
+
+        PositionListPtr result_tids(new PositionList());
+        for (uint64_t i = 0; i < bitmap->size(); i++) {
+            uint64_t matches = (*bitmap)[i];
+            while (matches != 0) {
+                result_tids->push_back(i * 64 + __builtin_ctzll(matches));
+                matches &= matches - 1;
+            }
+        }
+        return result_tids;
+    }
+
+    size_t BooleanColumn::count() const throw () {
+        //independent counters let the popcounts of neighbouring words overlap
+        uint64_t counts[4] = {0, 0, 0, 0};
+        uint64_t i = 0;
+        for (; i + 4 <= words.size(); i += 4) {
+            counts[0] += __builtin_popcountll(words[i]);
+            counts[1] += __builtin_popcountll(words[i + 1]);
+            counts[2] += __builtin_popcountll(words[i + 2]);
+            counts[3] += __builtin_popcountll(words[i + 3]);
+        }
+        for (; i < words.size(); i++) {
+            counts[0] += __builtin_popcountll(words[i]);
+        }
+        return counts[0] + counts[1] + counts[2] + counts[3];
+    }
+
+    size_t BooleanColumn::count(bool value) const throw () {
+        return value ? count() : numberOfValues - count();
+    }
+
+    bool BooleanColumn::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        oa << numberOfValues;
+        oa << words;
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    bool BooleanColumn::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        ia >> numberOfValues;
+        ia >> words;
+
+        infile.close();
+        return true;
+    }
+
+    bool BooleanColumn::isMaterialized() const throw () {
+        return true;
+    }
+
+    bool BooleanColumn::isCompressed() const throw () {
+        return false;
+    }
+
+    bool& BooleanColumn::operator[](const int tid) {
+        static bool t;
+        //check for out of range tid
+        if ((uint64_t) tid < numberOfValues) {
+            t = getValue(tid);
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    unsigned int BooleanColumn::getSizeinBytes() const throw () {
+        return words.capacity() * sizeof (uint64_t);
+    }
+
+}; //end namespace CogaDB
@@ -10,6 +10,14 @@
 #include <compression/RunLengthEncoding.hpp>
 #include <compression/BitVectorEncoding.hpp>
 #include <compression/DictionaryEncoding.hpp>
+#include <compression/FrameOfReferenceEncoding.hpp>
+#include <compression/DeltaEncoding.hpp>
+#include <compression/FloatXorEncoding.hpp>
+#include <compression/DecimalEncoding.hpp>
+#include <compression/SparseEncoding.hpp>
+#include <compression/PatchedFrameOfReferenceEncoding.hpp>
+#include <compression/CascadedEncoding.hpp>
+#include <compression/HuffmanEncoding.hpp>
 
 #include  "unittest.hpp"
 
@@ -43,7 +51,7 @@ int main() {
 
     std::cout << "Test #4: DictionaryEncoding<int>" << std::endl;
     std::cout << "---------------------------------" << std::endl;
-    if (!unittest<DictionaryEncoding, int>()) {
+    if (!unittest<DictionaryEncoding, int>() || !selection_unittest<DictionaryEncoding, int>()) {
         std::cout << "At least one Unittest Failed!" << std::endl;
         return -1;
     }
@@ -51,7 +59,7 @@ int main() {
 
     std::cout << "Test #5: DictionaryEncoding<float>" << std::endl;
     std::cout << "---------------------------------" << std::endl;
-    if (!unittest<DictionaryEncoding, float>()) {
+    if (!unittest<DictionaryEncoding, float>() || !selection_unittest<DictionaryEncoding, float>()) {
         std::cout << "At least one Unittest Failed!" << std::endl;
         return -1;
     }
@@ -59,7 +67,7 @@ int main() {
 
     std::cout << "Test #6: DictionaryEncoding<string>" << std::endl;
     std::cout << "---------------------------------" << std::endl;
-    if (!unittest<DictionaryEncoding, std::string>()) {
+    if (!unittest<DictionaryEncoding, std::string>() || !selection_unittest<DictionaryEncoding, std::string>()) {
         std::cout << "At least one Unittest Failed!" << std::endl;
         return -1;
     }
@@ -67,7 +75,7 @@ int main() {
 
     std::cout << "Test #7: RunLengthEncoding<int>" << std::endl;
     std::cout << "---------------------------------" << std::endl;
-    if (!unittest<RunLengthEncoding, int>()) {
+    if (!unittest<RunLengthEncoding, int>() || !selection_unittest<RunLengthEncoding, int>()) {
         std::cout << "At least one Unittest Failed!" << std::endl;
         return -1;
     }
@@ -75,7 +83,7 @@ int main() {
 
     std::cout << "Test #8: RunLengthEncoding<float>" << std::endl;
     std::cout << "---------------------------------" << std::endl;
-    if (!unittest<RunLengthEncoding, float>()) {
+    if (!unittest<RunLengthEncoding, float>() || !selection_unittest<RunLengthEncoding, float>()) {
         std::cout << "At least one Unittest Failed!" << std::endl;
         return -1;
     }
@@ -83,7 +91,140 @@ int main() {
 
     std::cout << "Test #9: RunLengthEncoding<string>" << std::endl;
     std::cout << "---------------------------------" << std::endl;
-    if (!unittest<RunLengthEncoding, std::string>()) {
+    if (!unittest<RunLengthEncoding, std::string>() || !selection_unittest<RunLengthEncoding, std::string>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #10: FrameOfReferenceEncoding<int>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<FrameOfReferenceEncoding, int>() || !selection_unittest<FrameOfReferenceEncoding, int>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #11: DeltaEncoding<int>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<DeltaEncoding, int>() || !selection_unittest<DeltaEncoding, int>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #12: FloatXorEncoding<float>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<FloatXorEncoding, float>() || !selection_unittest<FloatXorEncoding, float>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #13: DecimalEncoding<float>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<DecimalEncoding, float>() || !selection_unittest<DecimalEncoding, float>() || !decimal_sum_unittest()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #14: SparseEncoding<int>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<SparseEncoding, int>() || !selection_unittest<SparseEncoding, int>() || !sparse_unittest()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #15: SparseEncoding<string>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<SparseEncoding, std::string>() || !selection_unittest<SparseEncoding, std::string>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #16: PatchedFrameOfReferenceEncoding<int>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<PatchedFrameOfReferenceEncoding, int>() || !selection_unittest<PatchedFrameOfReferenceEncoding, int>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #17: CascadedEncoding<int>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<CascadedEncoding, int>() || !selection_unittest<CascadedEncoding, int>()
+            || !cascaded_unittest(UNCOMPRESSED_CODES) || !cascaded_unittest(RUN_LENGTH_CODES) || !cascaded_unittest(FRAME_OF_REFERENCE_CODES)
+            || !cascaded_unittest(PATCHED_FRAME_OF_REFERENCE_CODES) || !cascaded_unittest(DELTA_CODES)) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #18: CascadedEncoding<string>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<CascadedEncoding, std::string>() || !selection_unittest<CascadedEncoding, std::string>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #19: HuffmanEncoding<int>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<HuffmanEncoding, int>() || !selection_unittest<HuffmanEncoding, int>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #20: HuffmanEncoding<string>" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!unittest<HuffmanEncoding, std::string>() || !selection_unittest<HuffmanEncoding, std::string>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #21: BooleanColumn" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!boolean_column_unittest()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #22: StringHeapColumn" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!string_heap_column_unittest(true) || !string_heap_column_unittest(false)) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #23: ParallelizationMode" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!parallelization_unittest<Column, float>() || !parallelization_unittest<RunLengthEncoding, int>()
+            || !parallelization_unittest<DictionaryEncoding, std::string>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #24: Column Algebra" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!column_algebra_unittest<Column, float>() || !column_algebra_unittest<RunLengthEncoding, int>()
+            || !column_algebra_unittest<DictionaryEncoding, int>() || !column_algebra_unittest<BitVectorEncoding, int>()) {
+        std::cout << "At least one Unittest Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Unitests Passed!\n\n\n" << std::endl;
+
+    std::cout << "Test #25: Encoding Fallbacks" << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+    if (!fallback_unittest<DeltaEncoding, int>(get_unsorted_data()) || !fallback_unittest<PatchedFrameOfReferenceEncoding, int>(get_exception_data())
+            || !fallback_unittest<PatchedFrameOfReferenceEncoding, int>(get_low_outlier_data()) || !fallback_unittest<DecimalEncoding, float>(get_unscalable_data())) {
         std::cout << "At least one Unittest Failed!" << std::endl;
         return -1;
     }
@@ -0,0 +1,336 @@
+#include <core/string_heap_column.hpp>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+
+using namespace std;
+
+namespace CoGaDB {
+
+    StringHeapColumn::StringHeapColumn(const std::string& name, AttributeType db_type, bool useInlinePrefix) : ColumnBaseTyped<std::string>(name, db_type), useInlinePrefix(useInlinePrefix), heap(), offsets(1, 0), prefixes() {
+
+    }
+
+    StringHeapColumn::~StringHeapColumn() {
+
+    }
+
+    uint32_t StringHeapColumn::computePrefix(const char* data, size_t length) {
+        //missing bytes are zero, so comparing two prefixes as integers compares them lexicographically
+        uint32_t prefix = 0;
+        for (size_t i = 0; i < 4; i++) {
+            prefix <<= 8;
+            if (i < length) {
+                prefix |= (unsigned char) data[i];
+            }
+        }
+        return prefix;
+    }
+
+    void StringHeapColumn::rebuildPrefixes() {
+        prefixes.clear();
+        if (!useInlinePrefix) {
+            return;
+        }
+        prefixes.reserve(size());
+        for (TID i = 0; i < size(); i++) {
+            prefixes.push_back(computePrefix(getData(i), getLength(i)));
+        }
+    }
+
+    const char* StringHeapColumn::getData(TID tid) const {
+        return heap.empty() ? NULL : &heap[0] + offsets[tid];
+    }
+
+    size_t StringHeapColumn::getLength(TID tid) const {
+        return offsets[tid + 1] - offsets[tid];
+    }
+
+    bool StringHeapColumn::insert(const boost::any& newValue) {
+        //check for different type value
+        if (typeid (std::string) != newValue.type()) {
+            return false;
+        }
+        return this->insert(boost::any_cast<std::string>(newValue));
+    }
+
+    bool StringHeapColumn::insert(const std::string& newValue) {
+        heap.insert(heap.end(), newValue.begin(), newValue.end());
+        offsets.push_back(heap.size());
+        if (useInlinePrefix) {
+            prefixes.push_back(computePrefix(newValue.data(), newValue.size()));
+        }
+        return true;
+    }
+
+    bool StringHeapColumn::update(TID tid, const boost::any& newValue) {
+        //check for different type value or out of range tid
+        if (typeid (std::string) != newValue.type() || tid >= size()) {
+            return false;
+        }
+        std::string value = boost::any_cast<std::string>(newValue);
+
+        //values of equal length are overwritten in place, otherwise all following bytes move by the difference
+        size_t oldLength = getLength(tid);
+        if (value.size() > oldLength) {
+            heap.insert(heap.begin() + offsets[tid + 1], value.size() - oldLength, 0);
+        } else if (value.size() < oldLength) {
+            heap.erase(heap.begin() + offsets[tid] + value.size(), heap.begin() + offsets[tid + 1]);
+        }
+        std::copy(value.begin(), value.end(), heap.begin() + offsets[tid]);
+        for (TID i = tid + 1; i < offsets.size(); i++) {
+            offsets[i] = offsets[i] + value.size() - oldLength;
+        }
+
+        if (useInlinePrefix) {
+            prefixes[tid] = computePrefix(value.data(), value.size());
+        }
+        return true;
+    }
+
+    bool StringHeapColumn::update(PositionListPtr tids, const boost::any& newValue) {
+        //check for empty tid list or different type value
+        if (!tids || tids->empty() || typeid (std::string) != newValue.type()) {
+            return false;
+        }
+
+        //loop over the tids and update them one by one
+        for (uint64_t i = 0; i < tids->size(); i++) {
+            if (!this->update(tids->at(i), newValue)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool StringHeapColumn::remove(TID tid) {
+        //check for out of range tid
+        if (tid >= size()) {
+            return false;
+        }
+
+        size_t length = getLength(tid);
+        heap.erase(heap.begin() + offsets[tid], heap.begin() + offsets[tid + 1]);
+        offsets.erase(offsets.begin() + tid);
+        for (TID i = tid; i < offsets.size(); i++) {
+            offsets[i] -= length;
+        }
+        if (useInlinePrefix) {
+            prefixes.erase(prefixes.begin() + tid);
+        }
+        return true;
+    }
+
+    bool StringHeapColumn::remove(PositionListPtr tids) {
+        //check for empty tid list or empty column
+        if (!tids || tids->empty() || size() == 0) {
+            return false;
+        }
+        if (tids->back() >= size()) {
+            return false;
+        }
+
+        //move all remaining values from the first removed tid on to their new positions in one pass
+        TID target = tids->front();
+        uint32_t targetOffset = offsets[target];
+        PositionList::const_iterator it = tids->begin();
+        for (TID i = tids->front(); i < size(); i++) {
+            if (it != tids->end() && *it == i) {
+                ++it;
+                continue;
+            }
+            size_t length = getLength(i);
+            if (length > 0) {
+                std::memmove(&heap[targetOffset], &heap[offsets[i]], length);
+            }
+            if (useInlinePrefix) {
+                prefixes[target] = prefixes[i];
+            }
+            offsets[target] = targetOffset;
+            targetOffset += length;
+            target++;
+        }
+
+        offsets[target] = targetOffset;
+        offsets.resize(target + 1);
+        heap.resize(targetOffset);
+        if (useInlinePrefix) {
+            prefixes.resize(target);
+        }
+        return true;
+    }
+
+    bool StringHeapColumn::clearContent() {
+        heap.clear();
+        offsets.assign(1, 0);
+        prefixes.clear();
+        return true;
+    }
+
+    const boost::any StringHeapColumn::get(TID tid) {
+        if (tid < size()) {
+            return boost::any(std::string(getData(tid), getLength(tid)));
+        }
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return boost::any();
+    }
+
+    void StringHeapColumn::print() const throw () {
+        std::cout << "| " << this->name_ << " |" << std::endl;
+        std::cout << "________________________" << std::endl;
+        for (TID i = 0; i < size(); i++) {
+            std::cout << "| " << std::string(getData(i), getLength(i)) << " |" << std::endl;
+        }
+    }
+
+    size_t StringHeapColumn::size() const throw () {
+        return offsets.size() - 1;
+    }
+
+    const ColumnPtr StringHeapColumn::copy() const {
+        return ColumnPtr(new StringHeapColumn(*this));
+    }
+
+    void StringHeapColumn::decode(TID begin, size_t count, std::string* out) {
+        for (size_t i = 0; i < count; i++) {
+            out[i].assign(getData(begin + i), getLength(begin + i));
+        }
+    }
+
+    int StringHeapColumn::compare(TID tid, const std::string& value, uint32_t valuePrefix) const {
+        //different prefixes decide the comparison on their own
+        if (useInlinePrefix && prefixes[tid] != valuePrefix) {
+            return prefixes[tid] < valuePrefix ? -1 : 1;
+        }
+        size_t length = getLength(tid);
+        int result = length == 0 ? 0 : std::memcmp(getData(tid), value.data(), std::min(length, value.size()));
+        if (result != 0) {
+            return result;
+        }
+        return length < value.size() ? -1 : (length > value.size() ? 1 : 0);
+    }
+
+    const PositionListPtr StringHeapColumn::selection(const boost::any& value_for_comparison, const ValueComparator comp) {
+        if (value_for_comparison.type() != typeid (std::string)) {
+            return ColumnBaseTyped<std::string>::selection(value_for_comparison, comp);
+        }
+        std::string value = boost::any_cast<std::string>(value_for_comparison);
+        uint32_t valuePrefix = computePrefix(value.data(), value.size());
+
+        PositionListPtr result_tids(new PositionList());
+        if (comp == EQUAL) {
+            //equal values have equal lengths, so most values are rejected by the offsets or the prefix alone
+            for (TID i = 0; i < size(); i++) {
+                if (getLength(i) == value.size() && (!useInlinePrefix || prefixes[i] == valuePrefix)
+                        && (value.empty() || std::memcmp(getData(i), value.data(), value.size()) == 0)) {
+                    result_tids->push_back(i);
+                }
+            }
+        } else if (comp == LESSER) {
+            for (TID i = 0; i < size(); i++) {
+                if (compare(i, value, valuePrefix) < 0) {
+                    result_tids->push_back(i);
+                }
+            }
+        } else if (comp == GREATER) {
+            for (TID i = 0; i < size(); i++) {
+                if (compare(i, value, valuePrefix) > 0) {
+                    result_tids->push_back(i);
+                }
+            }
+        } else if (comp == PREFIX) {
+            //the inline prefix compares the first (up to four) characters of the pattern without reading the heap
+            size_t prefixLength = std::min(value.size(), (size_t) 4);
+            uint32_t mask = prefixLength == 0 ? 0 : ~uint32_t(0) << (32 - 8 * prefixLength);
+            for (TID i = 0; i < size(); i++) {
+                if (getLength(i) >= value.size() && (!useInlinePrefix || (prefixes[i] & mask) == (valuePrefix & mask))
+                        && (value.empty() || std::memcmp(getData(i), value.data(), value.size()) == 0)) {
+                    result_tids->push_back(i);
+                }
+            }
+        } else if (comp == SUBSTRING) {
+            //every value is searched in place on the heap, no string is materialized
+            for (TID i = 0; i < size(); i++) {
+                const char* data = getData(i);
+                size_t length = getLength(i);
+                if (value.empty() || (length >= value.size() && std::search(data, data + length, value.begin(), value.end()) != data + length)) {
+                    result_tids->push_back(i);
+                }
+            }
+        }
+        return result_tids;
+    }
+
+    bool StringHeapColumn::store(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ofstream outfile(path.c_str(), std::ios_base::binary | std::ios_base::out);
+        boost::archive::binary_oarchive oa(outfile);
+
+        //the offsets and the heap are written as two raw blobs, the prefixes are rebuilt on load
+        uint64_t numberOfValues = size();
+        uint64_t heapSize = heap.size();
+        oa << numberOfValues;
+        oa << heapSize;
+        oa.save_binary(&offsets[0], offsets.size() * sizeof (uint32_t));
+        if (heapSize > 0) {
+            oa.save_binary(&heap[0], heapSize);
+        }
+
+        outfile.flush();
+        outfile.close();
+        return true;
+    }
+
+    bool StringHeapColumn::load(const std::string& path_) {
+        std::string path(path_);
+        path += "/";
+        path += this->name_;
+
+        std::ifstream infile(path.c_str(), std::ios_base::binary | std::ios_base::in);
+        boost::archive::binary_iarchive ia(infile);
+
+        uint64_t numberOfValues;
+        uint64_t heapSize;
+        ia >> numberOfValues;
+        ia >> heapSize;
+        offsets.resize(numberOfValues + 1);
+        heap.resize(heapSize);
+        ia.load_binary(&offsets[0], offsets.size() * sizeof (uint32_t));
+        if (heapSize > 0) {
+            ia.load_binary(&heap[0], heapSize);
+        }
+        rebuildPrefixes();
+
+        infile.close();
+        return true;
+    }
+
+    bool StringHeapColumn::isMaterialized() const throw () {
+        return true;
+    }
+
+    bool StringHeapColumn::isCompressed() const throw () {
+        return false;
+    }
+
+    std::string& StringHeapColumn::operator[](const int tid) {
+        static std::string t;
+        //check for out of range tid
+        if ((size_t) tid < size()) {
+            t.assign(getData(tid), getLength(tid));
+            return t;
+        }
+
+        std::cout << "fatal Error!!! Invalid TID!!! Attribute: " << this->name_ << " TID: " << tid << std::endl;
+        return t;
+    }
+
+    unsigned int StringHeapColumn::getSizeinBytes() const throw () {
+        return heap.capacity() + offsets.capacity() * sizeof (uint32_t) + prefixes.capacity() * sizeof (uint32_t);
+    }
+
+}; //end namespace CogaDB
@@ -0,0 +1,188 @@
+#include <core/thread_pool.hpp>
+#include <boost/bind/bind.hpp>
+#include <algorithm>
+
+using namespace std;
+
+namespace CoGaDB {
+
+    static ParallelizationMode parallelizationMode = SERIAL;
+
+    void setParallelizationMode(ParallelizationMode mode) {
+        parallelizationMode = mode;
+    }
+
+    ParallelizationMode getParallelizationMode() {
+        return parallelizationMode;
+    }
+
+    boost::thread_specific_ptr<ThreadPool::Worker> ThreadPool::currentWorker(&ThreadPool::keepWorker);
+
+    ThreadPool::Worker::Worker(ThreadPool* pool) : pool(pool), mutex(), tasks() {
+
+    }
+
+    ThreadPool::ThreadPool(unsigned int numberOfWorkers) : workers(), external(this), numberOfQueuedTasks(0), mutex(), taskAvailable(), stopped(false), threads() {
+        for (unsigned int i = 0; i < numberOfWorkers; i++) {
+            workers.push_back(new Worker(this));
+        }
+        for (unsigned int i = 0; i < numberOfWorkers; i++) {
+            threads.create_thread(boost::bind(&ThreadPool::work, this, workers[i]));
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            stopped = true;
+        }
+        taskAvailable.notify_all();
+        threads.join_all();
+        for (unsigned int i = 0; i < workers.size(); i++) {
+            delete workers[i];
+        }
+    }
+
+    ThreadPool& ThreadPool::getGlobalThreadPool() {
+        //the thread that waits for a task group works as well, so one worker less than hardware threads keeps all of them busy
+        static ThreadPool pool(std::max(boost::thread::hardware_concurrency(), 2u) - 1);
+        return pool;
+    }
+
+    unsigned int ThreadPool::getNumberOfThreads() const {
+        return workers.size() + 1;
+    }
+
+    void ThreadPool::execute(const std::vector<Task>& tasks) {
+        TaskGroup group(*this);
+        for (size_t i = 0; i < tasks.size(); i++) {
+            group.run(tasks[i]);
+        }
+        group.wait();
+    }
+
+    void ThreadPool::keepWorker(Worker*) {
+
+    }
+
+    void ThreadPool::spawn(const Task& task, TaskGroup* group) {
+        Worker* self = currentWorker.get();
+        Worker* target = (self != NULL && self->pool == this) ? self : &external;
+        {
+            boost::lock_guard<boost::mutex> lock(target->mutex);
+            target->tasks.push_back(std::make_pair(task, group));
+        }
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            numberOfQueuedTasks++;
+        }
+        taskAvailable.notify_one();
+    }
+
+    bool ThreadPool::takeTask(std::pair<Task, TaskGroup*>& task) {
+        Worker* self = currentWorker.get();
+        if (self != NULL && self->pool != this) {
+            self = NULL;
+        }
+
+        bool found = false;
+        //the own deque is used like a stack
+        if (self != NULL) {
+            boost::lock_guard<boost::mutex> lock(self->mutex);
+            if (!self->tasks.empty()) {
+                task = self->tasks.back();
+                self->tasks.pop_back();
+                found = true;
+            }
+        }
+        //all other deques are stolen from like queues, starting with the tasks of other threads and the worker behind self
+        size_t start = self == NULL ? 0 : std::find(workers.begin(), workers.end(), self) - workers.begin() + 1;
+        for (size_t i = 0; !found && i <= workers.size(); i++) {
+            Worker* victim = i == 0 ? &external : workers[(start + i - 1) % workers.size()];
+            if (victim == self) {
+                continue;
+            }
+            boost::lock_guard<boost::mutex> lock(victim->mutex);
+            if (!victim->tasks.empty()) {
+                task = victim->tasks.front();
+                victim->tasks.pop_front();
+                found = true;
+            }
+        }
+
+        if (found) {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            numberOfQueuedTasks--;
+        }
+        return found;
+    }
+
+    bool ThreadPool::runTask() {
+        std::pair<Task, TaskGroup*> task;
+        if (!takeTask(task)) {
+            return false;
+        }
+        task.first();
+        task.second->finishTask();
+        return true;
+    }
+
+    void ThreadPool::work(Worker* worker) {
+        currentWorker.reset(worker);
+        while (true) {
+            {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                while (numberOfQueuedTasks == 0 && !stopped) {
+                    taskAvailable.wait(lock);
+                }
+                if (stopped) {
+                    return;
+                }
+            }
+            runTask();
+        }
+    }
+
+    TaskGroup::TaskGroup(ThreadPool& pool) : pool(pool), unfinishedTasks(0), mutex(), finished() {
+
+    }
+
+    TaskGroup::~TaskGroup() {
+        wait();
+    }
+
+    void TaskGroup::run(const ThreadPool::Task& task) {
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            unfinishedTasks++;
+        }
+        pool.spawn(task, this);
+    }
+
+    void TaskGroup::wait() {
+        while (true) {
+            {
+                boost::lock_guard<boost::mutex> lock(mutex);
+                if (unfinishedTasks == 0) {
+                    return;
+                }
+            }
+            //if nothing is queued, the remaining tasks run on other threads, which may still fork work to help with
+            if (!pool.runTask()) {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                if (unfinishedTasks > 0) {
+                    finished.timed_wait(lock, boost::posix_time::milliseconds(1));
+                }
+            }
+        }
+    }
+
+    void TaskGroup::finishTask() {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        unfinishedTasks--;
+        if (unfinishedTasks == 0) {
+            finished.notify_all();
+        }
+    }
+
+}; //end namespace CogaDB